@@ -2,6 +2,8 @@
 #include "Exceptions/UniversalStringException.h"
 #include <algorithm>
 
+namespace algstructures {
+
 Integer::Integer(const std::string& str) 
     : natural_(str[0] == '-' ? str.substr(1) : str),
       is_negative_(str[0] == '-') {
@@ -97,6 +99,10 @@ Integer Integer::operator*(const Integer& other) const {
     return Integer(product, result_negative);
 }
 
+Integer Integer::mulUi(std::uint64_t b) const {
+    return Integer(natural_.mulUi(b), is_negative_);
+}
+
 Integer Integer::operator/(const Integer& other) const {
     if (other.getSign() == 0)
         throw UniversalStringException("Integer:  cannot divide by zero");
@@ -136,4 +142,6 @@ Integer Integer::operator%(const Integer& other) const {
     }
     
     return remainder;
-}
\ No newline at end of file
+}
+
+}
@@ -8,6 +8,8 @@
  * Обладает всеми базовыми операциями, которые нужны.
  */
 
+namespace algstructures {
+
 class Integer {
 public:
     Integer(const std::string& str);
@@ -31,10 +33,13 @@ public:
     Integer operator*(const Integer& other) const;
     Integer operator/(const Integer& other) const;
     Integer operator%(const Integer& other) const;
+    Integer mulUi(std::uint64_t b) const;
 
 private:
     Natural natural_;
     bool is_negative_;
 };
 
+}
+
 #endif //INTEGER_H
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include <cmath>
 #include <algorithm>
 
+namespace algstructures {
+
 std::string Natural::toString() const {
     if (this->nums_.empty())
         throw UniversalStringException("Natural: atypical behavior, the vector of numbers should not be empty");
@@ -27,6 +29,15 @@ Natural::Natural(const std::string& str) {
         nums_.pop_back();
 }
 
+Natural Natural::fromUInt(std::uint64_t value) {
+    std::vector<uint8_t> digits;
+    do {
+        digits.push_back(static_cast<uint8_t>(value % 10));
+        value /= 10;
+    } while (value > 0);
+    return Natural(digits);
+}
+
 const std::vector<uint8_t>& Natural::getNums() const noexcept {
     return this->nums_;
 }
@@ -131,6 +142,23 @@ Natural Natural::operator*(std::size_t b) const {
     return Natural(res);
 }
 
+Natural Natural::mulUi(std::uint64_t b) const {
+    if (b == 0) return Natural(std::vector<uint8_t>{0});
+    std::vector<uint8_t> res;
+    res.reserve(this->nums_.size() + 20);
+    unsigned __int128 carry = 0;
+    for (size_t i = 0; i < this->nums_.size(); ++i) {
+        unsigned __int128 prod = static_cast<unsigned __int128>(this->nums_[i]) * b + carry;
+        res.push_back(static_cast<uint8_t>(prod % 10));
+        carry = prod / 10;
+    }
+    while (carry > 0) {
+        res.push_back(static_cast<uint8_t>(carry % 10));
+        carry /= 10;
+    }
+    return Natural(res);
+}
+
 Natural Natural::multiplyByPowerOfTen(std::size_t k) const {
 
 	if (!(*this != 0))
@@ -274,4 +302,6 @@ Natural Natural::lcm(const Natural& a, const Natural& b) {
         throw UniversalStringException("Natural:  the lcm for zeros is not uniquely defined");
     }
     return (a * b) / gcd(a, b);
-}
\ No newline at end of file
+}
+
+}
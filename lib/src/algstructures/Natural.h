@@ -1,5 +1,5 @@
-#ifndef NATURAL_H
-#define NATURAL_H
+#ifndef ALGSTRUCTURES_NATURAL_H
+#define ALGSTRUCTURES_NATURAL_H
 
 /**
 * @breif Класс натуральных чисел, реализация натуральных числе в рамках системы компютерной алгебры, обладает
@@ -11,14 +11,20 @@
 
 #include <vector>
 #include <iostream>
+#include <cstdint>
 
 
 
 
+// Старая реализация живет в своем пространстве имен: имена Natural/Integer/Rational заняты типами из core,
+// и без этого одноименные классы конфликтуют при линковке.
+namespace algstructures {
+
 class Natural {
 public:
     Natural (const std::vector<uint8_t> &numbers);
     Natural(const std::string& str);
+    static Natural fromUInt(std::uint64_t value);
 
     // Метод которые необходим для визуализации числа.
     std::string toString() const;
@@ -33,6 +39,7 @@ public:
     Natural operator-(const Natural& other) const;   // subtract
     Natural operator*(std::size_t b) const;          // multiplyByDigit
     Natural operator*(const Natural& other) const;   // multiply
+    Natural mulUi(std::uint64_t b) const;            // умножение на машинное слово
     Natural operator/(const Natural& other) const;   // quotient
     Natural operator%(const Natural& other) const;   // remainder
 
@@ -58,6 +65,8 @@ private:
 
 };
 
+}
+
 
 
-#endif //NATURAL_H
+#endif //ALGSTRUCTURES_NATURAL_H
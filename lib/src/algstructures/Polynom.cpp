@@ -1,7 +1,10 @@
 #include "Polynom.h"
 #include "Exceptions/UniversalStringException.h"
+#include "core/realization/Polynomial/modular_gcd.h"
 #include <algorithm>
 
+namespace algstructures {
+
 Polynom::Polynom(const std::vector<Rational>& coefficients)
     : coefficients_(coefficients) {
 
@@ -158,6 +161,53 @@ Polynom Polynom::factorOut() const {
     return *this * factor;
 }
 
+// out += a * b; Карацуба по участкам коэффициентов без промежуточных полиномов.
+void Polynom::multiplyInto(std::span<const Rational> a, std::span<const Rational> b, std::span<Rational> out) {
+    if (a.size() < b.size()) std::swap(a, b);
+    size_t n = a.size();
+    size_t m = b.size();
+    Rational zero(Integer("0"), Natural("1"));
+
+    if (m < karatsuba_threshold) {
+        for (size_t i = 0; i < n; ++i) {
+            if (a[i].getNumerator().getSign() == 0) continue;
+            for (size_t j = 0; j < m; ++j) out[i + j] = out[i + j] + a[i] * b[j];
+        }
+        return;
+    }
+
+    size_t k = (n + 1) / 2;
+    if (m <= k) {
+        for (size_t i = 0; i < n; i += m) {
+            size_t len = std::min(m, n - i);
+            multiplyInto(a.subspan(i, len), b, out.subspan(i, len + m - 1));
+        }
+        return;
+    }
+
+    std::span<const Rational> a0 = a.first(k), a1 = a.subspan(k);
+    std::span<const Rational> b0 = b.first(k), b1 = b.subspan(k);
+
+    std::vector<Rational> z0(2 * k - 1, zero);
+    multiplyInto(a0, b0, z0);
+    std::vector<Rational> z2(a1.size() + b1.size() - 1, zero);
+    multiplyInto(a1, b1, z2);
+
+    std::vector<Rational> sa(a0.begin(), a0.end());
+    for (size_t i = 0; i < a1.size(); ++i) sa[i] = sa[i] + a1[i];
+    std::vector<Rational> sb(b0.begin(), b0.end());
+    for (size_t i = 0; i < b1.size(); ++i) sb[i] = sb[i] + b1[i];
+
+    std::vector<Rational> z1(2 * k - 1, zero);
+    multiplyInto(sa, sb, z1);
+    for (size_t i = 0; i < z0.size(); ++i) z1[i] = z1[i] - z0[i];
+    for (size_t i = 0; i < z2.size(); ++i) z1[i] = z1[i] - z2[i];
+
+    for (size_t i = 0; i < z0.size(); ++i) out[i] = out[i] + z0[i];
+    for (size_t i = 0; i < z1.size() && i + k < out.size(); ++i) out[i + k] = out[i + k] + z1[i];
+    for (size_t i = 0; i < z2.size(); ++i) out[i + 2 * k] = out[i + 2 * k] + z2[i];
+}
+
 Polynom Polynom::operator*(const Polynom& other) const {
     Rational zero(Integer("0"), Natural("1"));
     
@@ -173,21 +223,11 @@ Polynom Polynom::operator*(const Polynom& other) const {
     std::vector<Rational> result;
     try {
         result.assign(n + m - 1, zero);
+        multiplyInto(coefficients_, other.coefficients_, result);
     } catch (const std::bad_alloc&) {
         throw UniversalStringException("Polynom:  not enough memory for polynomial multiplication");
     }
     
-    for (size_t i = 0; i < n; ++i) {
-        if (coefficients_[i].getNumerator().getSign() == 0) continue;
-        
-        for (size_t j = 0; j < m; ++j) {
-            if (other.coefficients_[j].getNumerator().getSign() == 0) continue;
-            
-            Rational product = coefficients_[i] * other.coefficients_[j];
-            result[i + j] = result[i + j] + product;
-        }
-    }
-    
     return Polynom(result);
 }
 
@@ -237,26 +277,41 @@ Polynom Polynom::operator%(const Polynom& other) const {
     return *this - product;
 }
 
+// Мост к модулярному НОД ядра: коэффициенты переводятся через десятичную запись.
+namespace {
+
+::Polynomial<::Q> toCore(const std::vector<Rational>& coefficients) {
+    std::vector<::Q> result;
+    result.reserve(coefficients.size());
+    for (const Rational& c : coefficients) {
+        const Integer& num = c.getNumerator();
+        ::Z numerator(::NatOper::fromString::execute(num.abs().toString()), num.isNegative());
+        result.push_back(::Q(numerator, ::N(::NatOper::fromString::execute(c.getDenominator().toString()))));
+    }
+    return ::Polynomial<::Q>(result);
+}
+
+std::vector<Rational> fromCore(const ::Polynomial<::Q>& poly) {
+    std::vector<Rational> result;
+    result.reserve(poly.coefficients.size());
+    for (const ::Q& c : poly.coefficients) {
+        const ::Rational& value = c.get();
+        result.emplace_back(Integer(value.numerator.toString()), Natural(value.denominator.toString()));
+    }
+    return result;
+}
+
+}
+
+// Нормированный НОД по модулярным образам (см. Modular::PolynomialGcd): Евклид над Rational
+// раздувает промежуточные дроби.
 Polynom Polynom::gcd(const Polynom& a, const Polynom& b) {
     if ((a.getDegree() == 0 && a.coefficients_[0].getNumerator().getSign() == 0) ||
         (b.getDegree() == 0 && b.coefficients_[0].getNumerator().getSign() == 0)) {
         throw UniversalStringException("Polynom:   cannot compute GCD with zero polynomial");
     }
     
-    Polynom first = a;
-    Polynom second = b;
-    
-    while (!(second.getDegree() == 0 && second.coefficients_[0].getNumerator().getSign() == 0)) {
-        Polynom temp = first % second;
-        first = second;
-        second = temp;
-    }
-    
-    Rational leading = first.getLeadingCoefficient();
-    Rational one(Integer("1"), Natural("1"));
-    Rational inverse = one / leading;
-    
-    return first * inverse;
+    return Polynom(fromCore(::Modular::PolynomialGcd::execute(toCore(a.coefficients_), toCore(b.coefficients_))));
 }
 
 Polynom Polynom::derivative() const {
@@ -268,8 +323,7 @@ Polynom Polynom::derivative() const {
     result.reserve(coefficients_.size() - 1);
     
     for (size_t i = 1; i < coefficients_.size(); ++i) {
-        Rational power(Integer(std::to_string(i)), Natural("1"));
-        result.push_back(coefficients_[i] * power);
+        result.push_back(coefficients_[i].mulUi(i));
     }
     
     return Polynom(result);
@@ -282,4 +336,6 @@ Polynom Polynom::makeSquareFree() const {
     Polynom deriv = derivative();
     Polynom gcd_poly = gcd(*this, deriv);
     return *this / gcd_poly;
-}
\ No newline at end of file
+}
+
+}
@@ -4,12 +4,15 @@
 #include "Rational.h"
 #include <vector>
 #include <string>
+#include <span>
 
 /**
  * @brief Данный класс описывает полиномы от одной переменной, над полем рациональных чисел.
  * Коэффициенты хранятся от младшей степени к старшей: {a0, a1, a2} = a0 + a1*x + a2*x^2
  */
 
+namespace algstructures {
+
 class Polynom {
 public:
     explicit Polynom(const std::vector<Rational>& coefficients);
@@ -32,7 +35,14 @@ public:
     Polynom makeSquareFree() const;
 
 private:
+    // Длина меньшего множителя, начиная с которой умножение идет по Карацубе.
+    static constexpr std::size_t karatsuba_threshold = 48;
+
+    static void multiplyInto(std::span<const Rational> a, std::span<const Rational> b, std::span<Rational> out);
+
     std::vector<Rational> coefficients_;  // от младшей к старшей степени
 };
 
+}
+
 #endif //POLYNOM_H
\ No newline at end of file
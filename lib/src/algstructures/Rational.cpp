@@ -1,15 +1,17 @@
 #include "Rational.h"
 #include "Exceptions/UniversalStringException.h"
 
+namespace algstructures {
+
 Rational::Rational(const Integer& numerator, const Natural& denominator)
-    : numerator_(numerator), denominator_(denominator) {
+    : numerator_(numerator), denominator_(denominator), reduced_(isOne(denominator)) {
     if (!(denominator_ != 0))
         throw UniversalStringException("Rational: denominator cannot be zero");
 }
 
 
 Rational::Rational(const std::string& str) 
-    : numerator_("0"), denominator_("1") {
+    : numerator_("0"), denominator_("1"), reduced_(true) {
     size_t delimiter_pos = str.find('/');
     
     if (delimiter_pos == std::string::npos) {
@@ -24,6 +26,7 @@ Rational::Rational(const std::string& str)
         
         if (!(denominator_ != 0))
             throw UniversalStringException("Rational:  denominator cannot be zero");
+        reduced_ = isOne(denominator_);
     }
 }
 
@@ -42,8 +45,9 @@ const Natural& Rational::getDenominator() const noexcept {
 void Rational::reduce() {
     Natural numerator_abs = numerator_.abs();
     Natural gcd = Natural::gcd(numerator_abs, denominator_);
+    reduced_ = true;
 
-    if (gcd.toString() == "1")
+    if (isOne(gcd))
         return;
 
     Integer gcd_as_int = Integer::fromNatural(gcd);
@@ -52,7 +56,15 @@ void Rational::reduce() {
 }
 
 bool Rational::isInteger() const {
-    return denominator_.toString() == "1";
+    return isOne(denominator_);
+}
+
+// Несократимая копия: формулы Хенричи верны только для несократимых операндов.
+Rational Rational::reduced() const {
+    Rational result = *this;
+    if (!result.reduced_)
+        result.reduce();
+    return result;
 }
 
 Rational Rational::fromInteger(const Integer& integer) {
@@ -65,61 +77,83 @@ Integer Rational::toInteger() const {
     return numerator_;
 }
 
+// Сложение по Хенричи: g = gcd(b, d), сумма числителей сокращается только на делители g.
+// Для несократимых операндов результат сразу несократим, остальные сокращаются заранее.
 Rational Rational::operator+(const Rational& other) const {
-    Natural common_denom = Natural::lcm(denominator_, other.denominator_);
-    
-    Natural factor_this = common_denom / denominator_;
-    Natural factor_other = common_denom / other.denominator_;
+    if (!reduced_ || !other.reduced_)
+        return reduced() + other.reduced();
+
+    Natural g = Natural::gcd(denominator_, other.denominator_);
+    if (isOne(g)) {
+        Integer sum_numerator = numerator_ * Integer::fromNatural(other.denominator_)
+                              + other.numerator_ * Integer::fromNatural(denominator_);
+        return irreducible(sum_numerator, denominator_ * other.denominator_);
+    }
 
-    Integer new_num_this = numerator_ * Integer::fromNatural(factor_this);
-    Integer new_num_other = other.numerator_ * Integer::fromNatural(factor_other);
-    
-    Integer sum_numerator = new_num_this + new_num_other;
-    
-    Rational result(sum_numerator, common_denom);
-    result.reduce();
-    return result;
+    Natural factor_this = other.denominator_ / g;
+    Natural factor_other = denominator_ / g;
+    Integer sum_numerator = numerator_ * Integer::fromNatural(factor_this)
+                          + other.numerator_ * Integer::fromNatural(factor_other);
+    if (sum_numerator.getSign() == 0)
+        return irreducible(sum_numerator, Natural("1"));
+
+    Natural g2 = Natural::gcd(sum_numerator.abs(), g);
+    if (isOne(g2))
+        return irreducible(sum_numerator, factor_other * other.denominator_);
+    return irreducible(sum_numerator / Integer::fromNatural(g2), factor_other * (other.denominator_ / g2));
 }
 
 
 Rational Rational::operator-(const Rational& other) const {
-    Natural common_denom = Natural::lcm(denominator_, other.denominator_);
-    
-    Natural factor_this = common_denom / denominator_;
-    Natural factor_other = common_denom / other.denominator_;
-    
-    Integer new_num_this = numerator_ * Integer::fromNatural(factor_this);
-    Integer new_num_other = other.numerator_ * Integer::fromNatural(factor_other);
-    
-    Integer diff_numerator = new_num_this - new_num_other;
-    
-    Rational result(diff_numerator, common_denom);
-    result.reduce();
-    return result;
+    Rational negated(-other.numerator_, other.denominator_);
+    negated.reduced_ = other.reduced_;
+    return *this + negated;
 }
 
+// Умножение по Хенричи: до умножения сокращаем крест-накрест на gcd(a, d) и gcd(c, b).
 Rational Rational::operator*(const Rational& other) const {
-    Integer new_numerator = numerator_ * other.numerator_;
-    Natural new_denominator = denominator_ * other.denominator_;
-    
-    Rational result(new_numerator, new_denominator);
-    result.reduce();
-    return result;
+    if (!reduced_ || !other.reduced_)
+        return reduced() * other.reduced();
+    return crossMultiply(numerator_, denominator_, other.numerator_, other.denominator_);
 }
 
 Rational Rational::operator/(const Rational& other) const {
     if (other.numerator_.getSign() == 0)
         throw UniversalStringException("Rational:  cannot divide by zero");
-    
-    Integer new_numerator = numerator_ * Integer::fromNatural(other.denominator_);
-    
-    Natural other_num_abs = other.numerator_.abs();
-    Natural new_denominator = denominator_ * other_num_abs;
-    
+    if (!reduced_ || !other.reduced_)
+        return reduced() / other.reduced();
+
+    Integer reciprocal_numerator = Integer::fromNatural(other.denominator_);
     if (other.numerator_.isNegative())
-        new_numerator = -new_numerator;
+        reciprocal_numerator = -reciprocal_numerator;
     
-    Rational result(new_numerator, new_denominator);
+    return crossMultiply(numerator_, denominator_, reciprocal_numerator, other.numerator_.abs());
+}
+
+Rational Rational::crossMultiply(const Integer& a, const Natural& b, const Integer& c, const Natural& d) {
+    Natural g1 = Natural::gcd(a.abs(), d);
+    Natural g2 = Natural::gcd(c.abs(), b);
+
+    Integer new_numerator = (a / Integer::fromNatural(g1)) * (c / Integer::fromNatural(g2));
+    Natural new_denominator = (b / g2) * (d / g1);
+    return irreducible(new_numerator, new_denominator);
+}
+
+Rational Rational::irreducible(const Integer& numerator, const Natural& denominator) {
+    Rational result(numerator, denominator);
+    result.reduced_ = true;
+    return result;
+}
+
+bool Rational::isOne(const Natural& num) {
+    const std::vector<uint8_t>& digits = num.getNums();
+    return digits.size() == 1 && digits[0] == 1;
+}
+
+Rational Rational::mulUi(std::uint64_t k) const {
+    Rational result(numerator_.mulUi(k), denominator_);
     result.reduce();
     return result;
-}
\ No newline at end of file
+}
+
+}
@@ -1,5 +1,5 @@
-#ifndef RATIONAL_H
-#define RATIONAL_H
+#ifndef ALGSTRUCTURES_RATIONAL_H
+#define ALGSTRUCTURES_RATIONAL_H
 
 #include "Integer.h"
 #include "Natural.h"
@@ -9,6 +9,8 @@
  * В будущем планируется построить архитектуру, позволяющую задавать и другие поля.
  */
 
+namespace algstructures {
+
 class Rational {
 public:
     Rational(const Integer& numerator, const Natural& denominator);
@@ -28,10 +30,21 @@ public:
     Rational operator-(const Rational& other) const;
     Rational operator*(const Rational& other) const;
     Rational operator/(const Rational& other) const;
+    Rational mulUi(std::uint64_t k) const;
 
 private:
+    static Rational crossMultiply(const Integer& a, const Natural& b, const Integer& c, const Natural& d);
+    static bool isOne(const Natural& num);
+    static Rational irreducible(const Integer& numerator, const Natural& denominator);
+    Rational reduced() const;
+
     Integer numerator_;
     Natural denominator_;
+    // Дробь заведомо несократима. Конструкторы не сокращают, поэтому флаг ставят reduce и арифметика
+    // Хенричи, а целые (знаменатель 1) несократимы сразу.
+    bool reduced_;
 };
 
-#endif //RATIONAL_H
\ No newline at end of file
+}
+
+#endif //ALGSTRUCTURES_RATIONAL_H
\ No newline at end of file
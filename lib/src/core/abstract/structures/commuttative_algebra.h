@@ -44,6 +44,9 @@ concept Ideal = requires(typename I::element_type ideal_elem,
  */
 struct Maximal {};
 
+// Пустой тэг для идеалов, которые выбирают Maximal условно (см. PrincipalIdealZ).
+struct NotMaximal {};
+
 template<typename I, typename T>
 concept MaximalIdeal = Ideal<I, T> && std::derived_from<I, Maximal>;
 
@@ -1,6 +1,8 @@
 #ifndef FACTORSTRUCTURES_H
 #define FACTORSTRUCTURES_H
 
+#include <cstdint>
+
 #include "groups.h"
 #include "commuttative_algebra.h"
 #include "rings.h"
@@ -76,6 +78,10 @@ public:
         return FactorRing(R::zero() - representative);
     }
 
+    FactorRing mulUi(std::uint64_t k) const {
+        return FactorRing(representative.mulUi(k));
+    }
+
     static FactorRing zero() {
         return FactorRing(R::zero());
     }
@@ -158,6 +164,10 @@ public:
     	return FactorField(R::zero() - this->representative);
     }
 
+	FactorField mulUi(std::uint64_t k) const {
+    	return FactorField(FactorRing<R, I>::mulUi(k));
+    }
+
 private:
     static FactorField inverse(FactorField a) {
         return FactorField(R(I::compute_inverse(a.get())));
@@ -21,7 +21,7 @@
 template<typename Derived, typename Output, typename... Inputs>
 class Mapping {
 public:
-    static Output execute(Inputs... args) {
+    static constexpr Output execute(Inputs... args) {
         return Derived::calc(args...);                          // Любое количество параметров, конечно, по опеределени
     }                                                           // отображение сопоставляет 1 элемент другому, но для
 };                                                              // улучшения семантики и наследуемости кода, было принято
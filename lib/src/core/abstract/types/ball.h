@@ -0,0 +1,28 @@
+#ifndef BALL_H
+#define BALL_H
+
+#include "floating.h"
+
+/**
+ * В файлах в директории types мы, условно, задаем типы объектов, которыми мы манипулируем в программе
+ * от части, они являются, в каком то смысле, множествами, над которыми выполняются операции и тп,
+ * но в угоду тому, что они не могут быть бесконечными, мы ограничиваеся только описанием типо, структуры и тп.
+ */
+
+
+/**
+ * @brief Шар (интервал в форме центр-радиус): все вещественные x с |x - mid| <= rad.
+ * Центр хранится с точностью mid.precision, радиус - неотрицательное число с малой точностью,
+ * которое всегда округляется вверх, так что точное значение гарантированно лежит в шаре.
+ */
+struct Ball {
+    Floating mid;
+    Floating rad;
+
+    constexpr Ball(Floating mid, Floating rad) : mid(std::move(mid)), rad(std::move(rad)) {
+        if (this->rad.is_neg) throw UniversalStringException("Ball: radius can not be negative");
+    }
+};
+
+
+#endif //BALL_H
@@ -0,0 +1,53 @@
+#ifndef FLOATING_H
+#define FLOATING_H
+
+#include <cstdint>
+
+#include "../../realization/Natural/N.h"
+
+/**
+ * В файлах в директории types мы, условно, задаем типы объектов, которыми мы манипулируем в программе
+ * от части, они являются, в каком то смысле, множествами, над которыми выполняются операции и тп,
+ * но в угоду тому, что они не могут быть бесконечными, мы ограничиваеся только описанием типо, структуры и тп.
+ */
+
+
+/**
+ * @brief Режим округления, как в MPFR: к ближайшему (половина - к четному), к нулю, к +бесконечности,
+ * к -бесконечности и от нуля.
+ */
+enum class RoundingMode {
+    Nearest,
+    TowardZero,
+    TowardPositive,
+    TowardNegative,
+    AwayFromZero
+};
+
+
+/**
+ * @brief Число с плавающей точкой произвольной точности: (-1)^is_neg * mantissa * 10^exponent.
+ *
+ * Основание десятичное, так как Natural хранит десятичные разряды и сдвиг на порядок стоит O(n).
+ * precision - число значащих десятичных цифр, до которого округляется результат каждой операции.
+ * Конструктор ничего не округляет, нормализацию делает Flt::Round.
+ */
+struct Floating {
+    N mantissa;
+    std::int64_t exponent;
+    std::uint64_t precision;
+    bool is_neg;
+
+    constexpr Floating(N mantissa, std::int64_t exponent, bool is_neg, std::uint64_t precision)
+        : mantissa(std::move(mantissa)), exponent(exponent), precision(precision), is_neg(is_neg) {
+        if (precision == 0) throw UniversalStringException("Floating: precision must be positive");
+        // У нуля один вид: +0 * 10^0.
+        if (this->mantissa.isZero()) {
+            this->exponent = 0;
+            this->is_neg = false;
+        }
+    }
+};
+
+
+#endif //FLOATING_H
@@ -0,0 +1,32 @@
+#ifndef HASH_CACHE_H
+#define HASH_CACHE_H
+
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @brief Ячейка для запомненного хэша значения (см. realization/Hashing/hash.h), 0 - хэш еще не считался.
+ *
+ * Ячейка mutable, так как хэш дописывается в константный объект. Копия переносит хэш вместе со значением,
+ * но во время вычислений на этапе компиляции чтение mutable поля запрещено, там копируется пустая ячейка
+ * (хэши на этапе компиляции все равно не считаются).
+ */
+struct HashCache {
+    mutable std::size_t value = 0;
+
+    constexpr HashCache() = default;
+
+    constexpr HashCache(const HashCache& other) {
+        if (!std::is_constant_evaluated())
+            value = other.value;
+    }
+
+    constexpr HashCache& operator=(const HashCache& other) {
+        value = 0;
+        if (!std::is_constant_evaluated())
+            value = other.value;
+        return *this;
+    }
+};
+
+#endif // HASH_CACHE_H
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <iostream>
+#include <cstdint>
 
 
 #include "../../realization/Natural/N.h"
@@ -16,13 +17,42 @@
 
 /**
  * @brief Простейшая структура целого числа, здесь есть базовый конструктор, и базовая структура числа.
+ *
+ * Число хранится в одном из двух видов (тэг is_small):
+ *  - малое - значение лежит прямо в small, natural пустой;
+ *  - большое - модуль лежит в natural, знак в is_neg.
+ * Вид всегда канонический: число в малом виде тогда и только тогда, когда |x| <= INT64_MAX,
+ * поэтому сравнивать виды двух чисел можно без обращения к natural. INT64_MIN в малый вид не
+ * попадает, чтобы смена знака никогда не переполнялась.
  */
 struct Integer {
     N natural;
-    bool is_neg;                  // false - положительный 
+    bool is_neg;                  // false - положительный, корректен в обоих видах
+    bool is_small;
+    std::int64_t small;
 
     // Ноль по умолчанию всегда положительный.
-    Integer (N number, bool sign): natural(number), is_neg(sign)  {if (number == N({0})) is_neg = false;};
+    constexpr Integer (N number, bool sign): natural(), is_neg(false), is_small(true), small(0) {
+        if (number.fitsUInt64()) {
+            std::uint64_t abs = number.toUInt64();
+            if (abs <= static_cast<std::uint64_t>(INT64_MAX)) {
+                small = sign ? -static_cast<std::int64_t>(abs) : static_cast<std::int64_t>(abs);
+                is_neg = small < 0;
+                return;
+            }
+        }
+        natural = std::move(number);
+        is_neg = sign;
+        is_small = false;
+    };
+
+    constexpr explicit Integer (std::int64_t value): natural(), is_neg(value < 0), is_small(true), small(value) {
+        if (value == INT64_MIN) {
+            natural = N(static_cast<std::uint64_t>(INT64_MAX) + 1);
+            is_small = false;
+            small = 0;
+        }
+    };
 };
 
 
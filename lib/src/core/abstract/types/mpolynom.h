@@ -0,0 +1,62 @@
+#ifndef MULTI_POLYNOMIAL_H
+#define MULTI_POLYNOMIAL_H
+
+#include <cstdint>
+#include <vector>
+#include "../../abstract/structures/rings.h"
+
+/**
+ * @brief Раскладка упакованного монома: показатели лежат полями по bits бит, старшие поля - в старших битах
+ * первых слов, так что сравнение слов как беззнаковых чисел сравнивает поля по порядку. У градуированных
+ * порядков первым полем идет полная степень.
+ *
+ * Старший бит каждого поля - сторож: у хранимых мономов он всегда 0, поэтому моном произведения - это
+ * просто сумма слов, а взведенный сторож после сложения означает переполнение поля.
+ */
+struct MonomialLayout {
+    std::size_t variables = 0;
+    bool graded = false;
+    unsigned bits = 8;   // 8, 16, 32 или 64
+
+    std::size_t fields() const { return variables + (graded ? 1 : 0); }
+    std::size_t perWord() const { return 64 / bits; }
+    std::size_t words() const { return fields() == 0 ? 1 : (fields() + perWord() - 1) / perWord(); }
+    // Наибольшее значение поля без сторожевого бита.
+    std::uint64_t limit() const { return (std::uint64_t{1} << (bits - 1)) - 1; }
+};
+
+/**
+ * @brief Член в распакованном виде: coefficient * x1^e1 * ... * xn^en.
+ */
+template<typename T>
+struct MultiTerm {
+    std::vector<std::uint64_t> exponents;
+    T coefficient;
+};
+
+/**
+ * @brief Полином от нескольких переменных над полем T с упакованными мономами.
+ * Члены хранятся по убыванию в мономиальном порядке Order, без нулевых коэффициентов:
+ * моном k занимает слова [k * words, (k + 1) * words) в monomials. Нулевой полином - без членов.
+ *
+ * @tparam T Тип поля (должен удовлетворять концепту Field)
+ * @tparam Order Мономиальный порядок (см. MonomialOrder)
+ */
+template<typename T, typename Order>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+struct MultiPolynomial {
+    using SetType = typename T::SetType;
+    MonomialLayout layout;
+    std::vector<std::uint64_t> monomials;
+    std::vector<T> coefficients;
+
+    explicit MultiPolynomial(std::size_t variables, unsigned bits = 8)
+        : layout{variables, Order::graded, bits} {}
+
+    std::size_t size() const { return coefficients.size(); }
+    bool isZero() const { return coefficients.empty(); }
+
+    const std::uint64_t* monomial(std::size_t k) const { return monomials.data() + k * layout.words(); }
+};
+
+#endif // MULTI_POLYNOMIAL_H
@@ -3,6 +3,9 @@
 
 #include <vector>
 #include <iostream>
+#include <cstdint>
+
+#include "hash_cache.h"
 
 
 /**
@@ -21,8 +24,9 @@
  */
 struct Natural {
     std::vector<uint8_t> nums; 
+    HashCache hash_cache;
 
-    Natural(const std::vector<uint8_t>& nums_i) : nums(nums_i) {
+    constexpr Natural(const std::vector<uint8_t>& nums_i) : nums(nums_i) {
         while (nums.size() > 1 && nums.back() == 0) {
             nums.pop_back();
         }
@@ -31,6 +35,22 @@ struct Natural {
             nums.push_back(0);
         }
     }
+
+    // Пустое число без разрядов. Корректным значением не является, используется только как заглушка
+    // там, где модуль хранится в другом виде (например, малые числа в Integer).
+    constexpr Natural() = default;
+
+    // Построение из машинного слова, раскладываем его по десятичным разрядам.
+    constexpr explicit Natural(std::uint64_t value) {
+        do {
+            nums.push_back(static_cast<uint8_t>(value % 10));
+            value /= 10;
+        } while (value > 0);
+    }
+
+    // Проверки за O(1), без построения второго числа для сравнения.
+    constexpr bool isZero() const { return nums.size() == 1 && nums[0] == 0; }
+    constexpr bool isOne() const { return nums.size() == 1 && nums[0] == 1; }
 };
 
 
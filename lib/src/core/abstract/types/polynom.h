@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <concepts>
+#include "hash_cache.h"
 #include "../../abstract/structures/rings.h"
 
 /**
@@ -16,6 +17,7 @@ requires Field<typename T::SetType, typename T::AdditionOp, typename T::Multipli
 struct Polynomial {
     using SetType = typename T::SetType;
     std::vector<T> coefficients;  // Коэффициенты [a0, a1, a2, ...]
+    HashCache hash_cache;
 
 	Polynomial(const std::vector<T>& coeffs) : coefficients(coeffs) {
 		T zero = T::zero();
@@ -4,6 +4,8 @@
 #include <vector>
 #include <iostream>
 
+#include "hash_cache.h"
+
 
 #include "../../realization/Natural/N.h"
 #include "../../realization/Integer/Z.h"
@@ -17,13 +19,17 @@
 
 /**
  * @brief Простейшая структура рационального числа, здесь есть базовый конструктор, и базовая структура числа.
+ * Флаг unreduced ставят операции, которые отложили сокращение результата (см. Rat::Normalize).
  */
 struct Rational {
     Z numerator;
     N denominator;
+    HashCache hash_cache;   // хэш сокращенной формы
+    bool unreduced = false;
 
-    Rational(Z numerator, N denum) : numerator(numerator), denominator(denum) {
-        if (denum == N({0})) throw UniversalStringException("denum do not be zero!");
+    constexpr Rational(Z numerator, N denum, bool unreduced = false)
+        : numerator(numerator), denominator(denum), unreduced(unreduced) {
+        if (denum.isZero()) throw UniversalStringException("denum do not be zero!");
     }
 };
 
@@ -0,0 +1,57 @@
+#ifndef SPARSE_POLYNOMIAL_H
+#define SPARSE_POLYNOMIAL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "../../abstract/structures/rings.h"
+
+/**
+ * @brief Член разреженного полинома: coefficient * x^exponent.
+ */
+template<typename T>
+struct SparseTerm {
+    std::uint64_t exponent;
+    T coefficient;
+};
+
+/**
+ * @brief Разреженный полином над полем T: только ненулевые члены, по возрастанию степени.
+ * x^1000000 + 1 хранится двумя членами, а не миллионом коэффициентов. Нулевой полином - пустой список.
+ *
+ * @tparam T Тип поля (должен удовлетворять концепту Field)
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+struct SparsePolynomial {
+    using SetType = typename T::SetType;
+    std::vector<SparseTerm<T>> terms;  // Члены по возрастанию степени, без нулевых коэффициентов
+
+    SparsePolynomial() = default;
+
+    // Члены в любом порядке: одинаковые степени складываются, нули отбрасываются.
+    SparsePolynomial(std::vector<SparseTerm<T>> unordered) {
+        std::stable_sort(unordered.begin(), unordered.end(),
+                         [](const SparseTerm<T>& a, const SparseTerm<T>& b) { return a.exponent < b.exponent; });
+        T zero = T::zero();
+        terms.reserve(unordered.size());
+        for (SparseTerm<T>& term : unordered) {
+            if (!terms.empty() && terms.back().exponent == term.exponent) {
+                terms.back().coefficient = terms.back().coefficient + term.coefficient;
+                if (terms.back().coefficient == zero) terms.pop_back();
+            } else if (!(term.coefficient == zero)) {
+                terms.push_back(std::move(term));
+            }
+        }
+    }
+
+    bool isZero() const {
+        return terms.empty();
+    }
+
+    std::uint64_t degree() const {
+        return terms.empty() ? 0 : terms.back().exponent;
+    }
+};
+
+#endif // SPARSE_POLYNOMIAL_H
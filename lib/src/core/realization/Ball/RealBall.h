@@ -0,0 +1,89 @@
+#ifndef BALL_STRUCTURE_H
+#define BALL_STRUCTURE_H
+
+#include "../../abstract/types/ball.h"
+#include "../Floating/BigFloat.h"
+#include "operations.h"
+
+
+/**
+ * @brief Обертка шаровой арифметики: вещественное число, известное с гарантированной погрешностью.
+ *
+ * Сравнения возвращают std::optional: ответ есть, только если шары не пересекаются. Если ответа нет,
+ * нужно поднять точность или перейти к точным вычислениям в Q.
+ */
+class RealBall {
+private:
+    Ball value;
+
+public:
+    static constexpr std::uint64_t default_precision = 30;
+
+    constexpr RealBall(Ball v) : value(std::move(v)) {}
+
+    constexpr explicit RealBall(const Q& num, std::uint64_t precision = default_precision)
+        : value(Balls::FromRational::execute(num.get(), precision)) {}
+
+    constexpr explicit RealBall(const Z& num, std::uint64_t precision = default_precision)
+        : value(Balls::FromInteger::execute(num.get(), precision)) {}
+
+    constexpr explicit RealBall(std::int64_t v, std::uint64_t precision = default_precision)
+        : value(Balls::FromInteger::execute(Integer(v), precision)) {}
+
+    // Шар с заданными центром и радиусом, радиус округляется вверх.
+    constexpr RealBall(const BigFloat& mid, const BigFloat& rad)
+        : value(mid.get(), Flt::Round::execute(rad.get(), Balls::rad_precision, RoundingMode::TowardPositive)) {}
+
+
+    constexpr RealBall operator+(const RealBall& other) const {
+        return RealBall(Balls::Add::execute(value, other.value));
+    }
+
+    constexpr RealBall operator-(const RealBall& other) const {
+        return RealBall(Balls::Sub::execute(value, other.value));
+    }
+
+    constexpr RealBall operator*(const RealBall& other) const {
+        return RealBall(Balls::Mul::execute(value, other.value));
+    }
+
+    constexpr RealBall operator/(const RealBall& other) const {
+        return RealBall(Balls::Div::execute(value, other.value));
+    }
+
+
+    // -1, 0, 1 или std::nullopt, если шар содержит точки разных знаков.
+    constexpr std::optional<int> sign() const { return Balls::Sign::execute(value); }
+
+    // Сравнение в кодах Cmp (0 - равны, 1 - меньше, 2 - больше), если оно решается по шарам.
+    constexpr std::optional<int> cmp(const RealBall& other) const {
+        std::optional<int> s = Balls::Sign::execute(Balls::Sub::execute(value, other.value));
+        if (!s) return std::nullopt;
+        return *s == 0 ? 0 : (*s < 0 ? 1 : 2);
+    }
+
+    constexpr bool containsZero() const {
+        return Flt::Cmp::execute(Balls::absOf(value.mid), value.rad) != 2;
+    }
+
+    // Границы шара с округлением наружу.
+    constexpr BigFloat lower() const {
+        return BigFloat(Flt::Sub::execute(value.mid, value.rad, value.mid.precision, RoundingMode::TowardNegative));
+    }
+
+    constexpr BigFloat upper() const {
+        return BigFloat(Flt::Add::execute(value.mid, value.rad, value.mid.precision, RoundingMode::TowardPositive));
+    }
+
+    constexpr BigFloat mid() const { return BigFloat(value.mid); }
+    constexpr BigFloat rad() const { return BigFloat(value.rad); }
+
+    constexpr const Ball& get() const { return value; }
+
+    std::string toString() const {
+        return "[" + Flt::toString::execute(value.mid) + " +/- " + Flt::toString::execute(value.rad) + "]";
+    }
+};
+
+
+#endif //BALL_STRUCTURE_H
@@ -0,0 +1,189 @@
+#ifndef OPERATIONS_BALL_H
+#define OPERATIONS_BALL_H
+
+#include <optional>
+
+#include "../../abstract/types/ball.h"
+#include "../../abstract/types/polynom.h"
+#include "../Floating/operations.h"
+#include "../Rational/Q.h"
+#include "../Polynomial/operations.h"
+
+/**
+ * В данном файле арифметика шаров (ball arithmetic, как в Arb).
+ *
+ * Центр результата округляется к ближайшему, а погрешность этого округления (единица последнего разряда,
+ * если результат мог не поместиться в точность) добавляется к радиусу. Радиус считается с rad_precision
+ * цифрами и всегда округляется вверх. Поэтому ответ "знак известен" всегда верен, а ответ "неизвестно"
+ * означает, что нужно либо поднять точность, либо считать точно.
+ */
+
+namespace Balls {
+
+inline constexpr std::uint64_t rad_precision = 10;
+
+constexpr Floating radZero() {
+    return Floating(N(std::uint64_t{0}), 0, false, rad_precision);
+}
+
+constexpr Floating absOf(Floating num) {
+    num.is_neg = false;
+    return num;
+}
+
+constexpr Floating radAdd(const Floating& a, const Floating& b) {
+    return Flt::Add::execute(a, b, rad_precision, RoundingMode::TowardPositive);
+}
+
+constexpr Floating radMul(const Floating& a, const Floating& b) {
+    return Flt::Mul::execute(absOf(a), absOf(b), rad_precision, RoundingMode::TowardPositive);
+}
+
+// Единица последнего разряда центра: граница ошибки округления к ближайшему.
+constexpr Floating ulpOf(const Floating& mid) {
+    if (mid.mantissa.isZero()) return radZero();
+    std::int64_t top = mid.exponent + Flt::lengthOf(mid.mantissa.get());
+    return Floating(N(std::uint64_t{1}), top - static_cast<std::int64_t>(mid.precision), false, rad_precision);
+}
+
+// Разрядов в точной сумме: от младшего разряда до старшего плюс возможный перенос.
+constexpr bool sumFits(const Floating& a, const Floating& b, std::uint64_t precision) {
+    if (a.mantissa.isZero()) return Flt::lengthOf(b.mantissa.get()) <= static_cast<std::int64_t>(precision);
+    if (b.mantissa.isZero()) return Flt::lengthOf(a.mantissa.get()) <= static_cast<std::int64_t>(precision);
+    std::int64_t top = std::max(a.exponent + Flt::lengthOf(a.mantissa.get()), b.exponent + Flt::lengthOf(b.mantissa.get()));
+    return top + 1 - std::min(a.exponent, b.exponent) <= static_cast<std::int64_t>(precision);
+}
+
+constexpr Ball withError(Floating mid, Floating rad, bool exact) {
+    if (!exact) rad = radAdd(rad, ulpOf(mid));
+    return Ball(std::move(mid), std::move(rad));
+}
+
+
+/**
+ * @brief Сложение шаров: радиусы складываются.
+ */
+class Add : public Mapping<Add, Ball, Ball, Ball>
+{
+public:
+    static constexpr Ball calc(Ball a, Ball b) {
+        std::uint64_t precision = std::max(a.mid.precision, b.mid.precision);
+        Floating mid = Flt::Add::execute(a.mid, b.mid, precision, RoundingMode::Nearest);
+        return withError(std::move(mid), radAdd(a.rad, b.rad), sumFits(a.mid, b.mid, precision));
+    }
+};
+
+class Sub : public Mapping<Sub, Ball, Ball, Ball>
+{
+public:
+    static constexpr Ball calc(Ball a, Ball b) {
+        if (!b.mid.mantissa.isZero()) b.mid.is_neg = !b.mid.is_neg;
+        return Add::execute(a, b);
+    }
+};
+
+/**
+ * @brief Умножение шаров: rad = |ma| rb + |mb| ra + ra rb.
+ */
+class Mul : public Mapping<Mul, Ball, Ball, Ball>
+{
+public:
+    static constexpr Ball calc(Ball a, Ball b) {
+        std::uint64_t precision = std::max(a.mid.precision, b.mid.precision);
+        Floating mid = Flt::Mul::execute(a.mid, b.mid, precision, RoundingMode::Nearest);
+        Floating rad = radAdd(radAdd(radMul(a.mid, b.rad), radMul(b.mid, a.rad)), radMul(a.rad, b.rad));
+        bool exact = Flt::lengthOf(a.mid.mantissa.get()) + Flt::lengthOf(b.mid.mantissa.get())
+                     <= static_cast<std::int64_t>(precision);
+        return withError(std::move(mid), std::move(rad), exact);
+    }
+};
+
+/**
+ * @brief Деление шаров: rad = (|ma| rb + ra |mb|) / (|mb| (|mb| - rb)). Делитель не должен содержать нуль.
+ */
+class Div : public Mapping<Div, Ball, Ball, Ball>
+{
+public:
+    static constexpr Ball calc(Ball a, Ball b) {
+        Floating mb = absOf(b.mid);
+        if (Flt::Cmp::execute(mb, b.rad) != 2)
+            throw UniversalStringException("Ball: division by a ball containing zero");
+
+        std::uint64_t precision = std::max(a.mid.precision, b.mid.precision);
+        Floating mid = Flt::Div::execute(a.mid, b.mid, precision, RoundingMode::Nearest);
+
+        Floating numerator = radAdd(radMul(a.mid, b.rad), radMul(a.rad, b.mid));
+        Floating gap = Flt::Sub::execute(mb, b.rad, rad_precision, RoundingMode::TowardNegative);
+        Floating denominator = Flt::Mul::execute(mb, gap, rad_precision, RoundingMode::TowardNegative);
+        Floating rad = Flt::Div::execute(numerator, denominator, rad_precision, RoundingMode::TowardPositive);
+        return withError(std::move(mid), std::move(rad), false);
+    }
+};
+
+
+/**
+ * @brief Шар вокруг рационального числа. Радиус нулевой, если число представимо точно.
+ */
+class FromRational : public Mapping<FromRational, Ball, Rational, std::uint64_t>
+{
+public:
+    static constexpr Ball calc(Rational num, std::uint64_t precision) {
+        Floating mid = Flt::FromRational::execute(num, precision, RoundingMode::Nearest);
+        bool exact = Rat::Cmp::execute(Flt::ToRational::execute(mid), num) == 0;
+        return withError(std::move(mid), radZero(), exact);
+    }
+};
+
+class FromInteger : public Mapping<FromInteger, Ball, Integer, std::uint64_t>
+{
+public:
+    static constexpr Ball calc(Integer num, std::uint64_t precision) {
+        Floating mid = Flt::FromInteger::execute(num, precision, RoundingMode::Nearest);
+        bool exact = Z(Flt::ToInteger::execute(mid, RoundingMode::TowardZero)) == Z(num);
+        return withError(std::move(mid), radZero(), exact);
+    }
+};
+
+
+/**
+ * @brief Знак всех точек шара: -1, 0 или 1, если он один для всего шара, иначе std::nullopt.
+ * Нуль определяется только у шара нулевого радиуса с нулевым центром.
+ */
+class Sign : public Mapping<Sign, std::optional<int>, Ball>
+{
+public:
+    static constexpr std::optional<int> calc(Ball num) {
+        if (num.mid.mantissa.isZero())
+            return num.rad.mantissa.isZero() ? std::optional<int>(0) : std::nullopt;
+        if (Flt::Cmp::execute(absOf(num.mid), num.rad) != 2)
+            return std::nullopt;
+        return num.mid.is_neg ? -1 : 1;
+    }
+};
+
+
+/**
+ * @brief Знак значения полинома с рациональными коэффициентами в рациональной точке.
+ * Сначала схема Горнера в шарах с точностью precision; точное вычисление в Q - только если шар содержит нуль.
+ */
+class SignAt : public Mapping<SignAt, int, Polynomial<Q>, Q, std::uint64_t>
+{
+public:
+    static int calc(Polynomial<Q> poly, Q x, std::uint64_t precision) {
+        Ball point = FromRational::execute(x.get(), precision);
+        Ball value = FromRational::execute(poly.coefficients.back().get(), precision);
+        for (size_t i = poly.coefficients.size() - 1; i-- > 0;) {
+            value = Add::execute(Mul::execute(value, point), FromRational::execute(poly.coefficients[i].get(), precision));
+        }
+        if (std::optional<int> sign = Sign::execute(value))
+            return *sign;
+
+        Q exact = Poly::Evaluate<Q>::execute(poly, x);
+        if (exact.isZero()) return 0;
+        return exact.isNegative() ? -1 : 1;
+    }
+};
+
+}
+
+#endif //OPERATIONS_BALL_H
@@ -0,0 +1,139 @@
+#ifndef FLOATING_STRUCTURE_H
+#define FLOATING_STRUCTURE_H
+
+#include "../../abstract/types/floating.h"
+#include "../Rational/Q.h"
+#include "operations.h"
+#include "elementary.h"
+
+
+/**
+ * @brief Обертка чисел с плавающей точкой произвольной точности.
+ *
+ * Каждый объект помнит свою точность. Операторы округляют к ближайшему до большей из точностей операндов,
+ * статические add/sub/mul/div/sqrt позволяют задать точность и режим округления явно.
+ * Полем это множество не является (сложение не ассоциативно), поэтому операций для концептов нет.
+ */
+class BigFloat {
+private:
+    Floating value;
+
+public:
+    static constexpr std::uint64_t default_precision = 30;
+
+    constexpr BigFloat(Floating v) : value(std::move(v)) {}
+
+    constexpr explicit BigFloat(std::int64_t v, std::uint64_t precision = default_precision)
+        : value(Flt::FromInteger::execute(Integer(v), precision, RoundingMode::Nearest)) {}
+
+    constexpr explicit BigFloat(const Z& num, std::uint64_t precision = default_precision,
+                                RoundingMode mode = RoundingMode::Nearest)
+        : value(Flt::FromInteger::execute(num.get(), precision, mode)) {}
+
+    constexpr explicit BigFloat(const Q& num, std::uint64_t precision = default_precision,
+                                RoundingMode mode = RoundingMode::Nearest)
+        : value(Flt::FromRational::execute(num.get(), precision, mode)) {}
+
+
+    static constexpr BigFloat add(const BigFloat& a, const BigFloat& b, std::uint64_t precision,
+                                  RoundingMode mode = RoundingMode::Nearest) {
+        return BigFloat(Flt::Add::execute(a.value, b.value, precision, mode));
+    }
+
+    static constexpr BigFloat sub(const BigFloat& a, const BigFloat& b, std::uint64_t precision,
+                                  RoundingMode mode = RoundingMode::Nearest) {
+        return BigFloat(Flt::Sub::execute(a.value, b.value, precision, mode));
+    }
+
+    static constexpr BigFloat mul(const BigFloat& a, const BigFloat& b, std::uint64_t precision,
+                                  RoundingMode mode = RoundingMode::Nearest) {
+        return BigFloat(Flt::Mul::execute(a.value, b.value, precision, mode));
+    }
+
+    static constexpr BigFloat div(const BigFloat& a, const BigFloat& b, std::uint64_t precision,
+                                  RoundingMode mode = RoundingMode::Nearest) {
+        return BigFloat(Flt::Div::execute(a.value, b.value, precision, mode));
+    }
+
+    static constexpr BigFloat sqrt(const BigFloat& a, std::uint64_t precision,
+                                   RoundingMode mode = RoundingMode::Nearest) {
+        return BigFloat(Flt::Sqrt::execute(a.value, precision, mode));
+    }
+
+
+    constexpr BigFloat operator+(const BigFloat& other) const {
+        return add(*this, other, std::max(precision(), other.precision()));
+    }
+
+    constexpr BigFloat operator-(const BigFloat& other) const {
+        return sub(*this, other, std::max(precision(), other.precision()));
+    }
+
+    constexpr BigFloat operator*(const BigFloat& other) const {
+        return mul(*this, other, std::max(precision(), other.precision()));
+    }
+
+    constexpr BigFloat operator/(const BigFloat& other) const {
+        return div(*this, other, std::max(precision(), other.precision()));
+    }
+
+    constexpr BigFloat operator-() const {
+        Floating negated = value;
+        if (!negated.mantissa.isZero()) negated.is_neg = !negated.is_neg;
+        return BigFloat(std::move(negated));
+    }
+
+    constexpr BigFloat sqrt() const { return sqrt(*this, precision()); }
+
+    // Элементарные функции с точностью числа (см. elementary.h).
+    BigFloat exp() const { return BigFloat(Flt::Exp::execute(value, precision())); }
+    BigFloat log() const { return BigFloat(Flt::Log::execute(value, precision())); }
+    BigFloat sin() const { return BigFloat(Flt::Sin::execute(value, precision())); }
+    BigFloat cos() const { return BigFloat(Flt::Cos::execute(value, precision())); }
+    BigFloat atan() const { return BigFloat(Flt::Atan::execute(value, precision())); }
+
+    // Константы кэшируются: повторный запрос с той же или меньшей точностью только округляет.
+    static BigFloat pi(std::uint64_t precision = default_precision) { return BigFloat(Flt::pi(precision)); }
+    static BigFloat e(std::uint64_t precision = default_precision) { return BigFloat(Flt::e(precision)); }
+    static BigFloat ln2(std::uint64_t precision = default_precision) { return BigFloat(Flt::ln2(precision)); }
+
+    // Округление до другой точности.
+    constexpr BigFloat withPrecision(std::uint64_t precision, RoundingMode mode = RoundingMode::Nearest) const {
+        return BigFloat(Flt::Round::execute(value, precision, mode));
+    }
+
+
+    constexpr bool operator>(const BigFloat& other) const {
+        return Flt::Cmp::execute(value, other.value) == 2;
+    }
+
+    constexpr bool operator<(const BigFloat& other) const {
+        return Flt::Cmp::execute(value, other.value) == 1;
+    }
+
+    constexpr bool operator==(const BigFloat& other) const {
+        return Flt::Cmp::execute(value, other.value) == 0;
+    }
+
+
+    // Точные преобразования: число вида m * 10^e всегда рационально.
+    constexpr Q toQ() const { return Q(Flt::ToRational::execute(value)); }
+
+    constexpr Z toZ(RoundingMode mode = RoundingMode::TowardZero) const {
+        return Z(Flt::ToInteger::execute(value, mode));
+    }
+
+    constexpr std::uint64_t precision() const { return value.precision; }
+    constexpr std::int64_t exponent() const { return value.exponent; }
+    constexpr bool isZero() const { return value.mantissa.isZero(); }
+    constexpr bool isNegative() const { return value.is_neg; }
+
+    constexpr const Floating& get() const { return value; }
+
+    std::string toString() const {
+        return Flt::toString::execute(value);
+    }
+};
+
+
+#endif //FLOATING_STRUCTURE_H
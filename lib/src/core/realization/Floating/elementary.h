@@ -0,0 +1,504 @@
+#ifndef ELEMENTARY_FLOATING_H
+#define ELEMENTARY_FLOATING_H
+
+#include <cmath>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "operations.h"
+
+/**
+ * В данном файле элементарные функции и константы для чисел с плавающей точкой.
+ *
+ * Основа - бинарное разбиение (binary splitting) гипергеометрических рядов над Z: сумма ряда с рациональными
+ * отношениями соседних членов собирается деревом произведений в одну дробь T / (B Q), и длинное деление
+ * делается один раз в конце. Так считаются pi (Чудновские), e, ln2 и ln10 (формулы Мэчина для atanh),
+ * а также exp, sin и cos.
+ *
+ * Для exp, sin и cos аргумент сначала приводится (x - n ln10 и x - n pi/2), затем остаток режется на куски
+ * с 1, 2, 4, 8, ... десятичными цифрами (bit-burst): у каждого куска короткий числитель, поэтому его ряд
+ * бинарно разбивается дешево, а результаты собираются произведением (для sin/cos - формулами сложения).
+ * log и atan получаются итерациями Ньютона по exp и по sin/cos с удвоением точности.
+ *
+ * Вычисления идут с guard_digits запасными цифрами, итог округляется к ближайшему. Результат отличается
+ * от точного не больше чем на единицу последнего разряда, но, в отличие от арифметики, не гарантированно
+ * корректно округлен.
+ */
+
+namespace Flt {
+
+inline constexpr std::uint64_t guard_digits = 10;
+
+/**
+ * @brief Частичная сумма гипергеометрического ряда sum a(n)/b(n) * p(0)...p(n) / (q(0)...q(n)) на [n1, n2)
+ * в виде P = prod p, Q = prod q, B = prod b, T = B Q S.
+ */
+struct SeriesSplit {
+    Z P;
+    Z Q;
+    Z B;
+    Z T;
+};
+
+struct SeriesTerm {
+    Z p;
+    Z q;
+    Z a;
+    Z b;
+};
+
+template<typename TermFn>
+SeriesSplit splitSeries(std::uint64_t n1, std::uint64_t n2, const TermFn& term) {
+    if (n2 - n1 == 1) {
+        SeriesTerm t = term(n1);
+        return {t.p, t.q, t.b, t.a * t.p};
+    }
+    std::uint64_t mid = n1 + (n2 - n1) / 2;
+    SeriesSplit left = splitSeries(n1, mid, term);
+    SeriesSplit right = splitSeries(mid, n2, term);
+    return {left.P * right.P,
+            left.Q * right.Q,
+            left.B * right.B,
+            right.B * right.Q * left.T + left.B * left.P * right.T};
+}
+
+// Сумма первых terms членов ряда с точностью precision.
+template<typename TermFn>
+Floating sumSeries(std::uint64_t terms, const TermFn& term, std::uint64_t precision) {
+    SeriesSplit s = splitSeries(0, terms, term);
+    Z denominator = s.B * s.Q;
+    bool negative = denominator.isNegative();
+    N denominator_abs = Z::abs(denominator);
+    Z numerator = negative ? -s.T : s.T;
+    return FromRational::execute(Rational(numerator, denominator_abs), precision, RoundingMode::Nearest);
+}
+
+// Сколько членов ряда с отношением |x| / k нужно, чтобы остаток был меньше 10^-precision.
+inline std::uint64_t termsForFactorialSeries(long double log10_x, std::uint64_t precision, std::uint64_t step = 1) {
+    long double log10_term = 0;
+    std::uint64_t n = 1;
+    while (log10_term > -static_cast<long double>(precision) - 2 || n < 3) {
+        for (std::uint64_t i = 0; i < step; ++i) {
+            log10_term += log10_x - std::log10(static_cast<long double>(step * n + i));
+        }
+        ++n;
+    }
+    return n + 1;
+}
+
+
+constexpr Floating fromWord(std::int64_t v, std::uint64_t precision) {
+    return FromInteger::execute(Integer(v), precision, RoundingMode::Nearest);
+}
+
+constexpr Floating negate(Floating num) {
+    if (!num.mantissa.isZero()) num.is_neg = !num.is_neg;
+    return num;
+}
+
+// Позиция над старшей цифрой: |x| < 10^top.
+constexpr std::int64_t topOf(const Floating& num) {
+    return num.exponent + lengthOf(num.mantissa.get());
+}
+
+// Грубое приближение для начальных значений итераций.
+inline long double toLongDouble(const Floating& num) {
+    if (num.mantissa.isZero()) return 0;
+    const Natural& m = num.mantissa.get();
+    std::size_t taken = std::min<std::size_t>(m.nums.size(), 18);
+    long double value = 0;
+    for (std::size_t i = 0; i < taken; ++i) value = value * 10 + m.nums[m.nums.size() - 1 - i];
+    std::int64_t e = num.exponent + static_cast<std::int64_t>(m.nums.size() - taken);
+    e = std::clamp<std::int64_t>(e, -4900, 4900);
+    value *= std::pow(10.0L, static_cast<long double>(e));
+    return num.is_neg ? -value : value;
+}
+
+inline Floating fromLongDouble(long double value, std::uint64_t precision) {
+    constexpr std::int64_t digits = 15;
+    if (value == 0) return zero(precision);
+    int e10 = static_cast<int>(std::floor(std::log10(std::fabs(value)))) - static_cast<int>(digits);
+    long double scaled = value / std::pow(10.0L, static_cast<long double>(e10));
+    Floating mantissa = fromWord(static_cast<std::int64_t>(std::llround(scaled)), precision);
+    mantissa.exponent += e10;
+    return mantissa;
+}
+
+
+/**
+ * @brief Кэш константы: хранит значение с наибольшей посчитанной точностью, меньшие точности получаются
+ * округлением. Безопасен для нескольких потоков.
+ */
+class ConstantCache {
+private:
+    Floating (*compute)(std::uint64_t);
+    std::optional<Floating> value;
+    std::uint64_t valid = 0;   // до скольких цифр значение можно округлять
+    std::mutex lock;
+
+public:
+    explicit ConstantCache(Floating (*compute)(std::uint64_t)) : compute(compute) {}
+
+    Floating get(std::uint64_t precision) {
+        std::lock_guard guard(lock);
+        if (!value || valid < precision) {
+            std::uint64_t target = std::max(precision, valid + valid / 2);
+            value = compute(target + guard_digits);
+            valid = target;
+        }
+        return Round::execute(*value, precision, RoundingMode::Nearest);
+    }
+};
+
+
+// pi по формуле Чудновских, каждый член дает около 14 цифр.
+inline Floating computePi(std::uint64_t precision) {
+    const Z c3_over_24(std::int64_t{10939058860032000});
+    auto term = [&c3_over_24](std::uint64_t n) -> SeriesTerm {
+        Z a = Z(std::int64_t{13591409}) + Z(std::int64_t{545140134}) * Z(static_cast<std::int64_t>(n));
+        if (n == 0)
+            return {Z(std::int64_t{1}), Z(std::int64_t{1}), a, Z(std::int64_t{1})};
+        std::int64_t k = static_cast<std::int64_t>(n);
+        Z p = -(Z(6 * k - 5) * Z(2 * k - 1) * Z(6 * k - 1));
+        Z q = Z(k) * Z(k) * Z(k) * c3_over_24;
+        return {p, q, a, Z(std::int64_t{1})};
+    };
+    std::uint64_t wp = precision + guard_digits;
+    Floating sum = sumSeries(wp / 14 + 2, term, wp);
+    Floating root = Sqrt::execute(fromWord(10005, wp), wp, RoundingMode::Nearest);
+    Floating numerator = Mul::execute(fromWord(426880, wp), root, wp, RoundingMode::Nearest);
+    return Div::execute(numerator, sum, precision, RoundingMode::Nearest);
+}
+
+// e = sum 1/n!.
+inline Floating computeE(std::uint64_t precision) {
+    auto term = [](std::uint64_t n) -> SeriesTerm {
+        Z one(std::int64_t{1});
+        return {one, n == 0 ? one : Z(static_cast<std::int64_t>(n)), one, one};
+    };
+    std::uint64_t wp = precision + guard_digits;
+    return Round::execute(sumSeries(termsForFactorialSeries(0, wp), term, wp), precision, RoundingMode::Nearest);
+}
+
+// atanh(1/m) = sum 1 / ((2n + 1) m^(2n+1)).
+inline Floating atanhInverse(std::uint64_t m, std::uint64_t precision) {
+    Z mz(static_cast<std::int64_t>(m));
+    Z m2 = mz * mz;
+    auto term = [&mz, &m2](std::uint64_t n) -> SeriesTerm {
+        Z one(std::int64_t{1});
+        return {one, n == 0 ? mz : m2, one, Z(static_cast<std::int64_t>(2 * n + 1))};
+    };
+    long double digits_per_term = 2 * std::log10(static_cast<long double>(m));
+    std::uint64_t terms = static_cast<std::uint64_t>(static_cast<long double>(precision + 2) / digits_per_term) + 2;
+    return sumSeries(terms, term, precision);
+}
+
+// ln2 = 18 atanh(1/26) - 2 atanh(1/4801) + 8 atanh(1/8749).
+inline Floating computeLn2(std::uint64_t precision) {
+    std::uint64_t wp = precision + guard_digits;
+    Floating a = Mul::execute(fromWord(18, wp), atanhInverse(26, wp), wp, RoundingMode::Nearest);
+    Floating b = Mul::execute(fromWord(2, wp), atanhInverse(4801, wp), wp, RoundingMode::Nearest);
+    Floating c = Mul::execute(fromWord(8, wp), atanhInverse(8749, wp), wp, RoundingMode::Nearest);
+    return Add::execute(Sub::execute(a, b, wp, RoundingMode::Nearest), c, precision, RoundingMode::Nearest);
+}
+
+inline Floating ln2(std::uint64_t precision);
+
+// ln10 = 3 ln2 + ln(5/4), ln(5/4) = 2 atanh(1/9).
+inline Floating computeLn10(std::uint64_t precision) {
+    std::uint64_t wp = precision + guard_digits;
+    Floating three_ln2 = Mul::execute(fromWord(3, wp), ln2(wp), wp, RoundingMode::Nearest);
+    Floating ln_five_quarters = Mul::execute(fromWord(2, wp), atanhInverse(9, wp), wp, RoundingMode::Nearest);
+    return Add::execute(three_ln2, ln_five_quarters, precision, RoundingMode::Nearest);
+}
+
+inline Floating pi(std::uint64_t precision) {
+    static ConstantCache cache(computePi);
+    return cache.get(precision);
+}
+
+inline Floating e(std::uint64_t precision) {
+    static ConstantCache cache(computeE);
+    return cache.get(precision);
+}
+
+inline Floating ln2(std::uint64_t precision) {
+    static ConstantCache cache(computeLn2);
+    return cache.get(precision);
+}
+
+inline Floating ln10(std::uint64_t precision) {
+    static ConstantCache cache(computeLn10);
+    return cache.get(precision);
+}
+
+
+/**
+ * @brief Кусок приведенного аргумента: u / 10^scale, |u| < 10^(scale - start).
+ */
+struct ArgumentChunk {
+    Z u;
+    std::uint64_t scale;
+};
+
+/**
+ * @brief Разрезание |r| < 10 на куски с цифрами после запятой (0, 1], (1, 2], (2, 4], (4, 8], ... до digits.
+ * r округляется к нулю на digits цифрах.
+ */
+inline std::vector<ArgumentChunk> splitArgument(const Floating& r, std::uint64_t digits) {
+    std::vector<ArgumentChunk> chunks;
+    if (r.mantissa.isZero()) return chunks;
+
+    Floating scaled = r;
+    scaled.exponent += static_cast<std::int64_t>(digits);
+    Integer fixed = ToInteger::execute(scaled, RoundingMode::TowardZero);
+    N fixed_abs = Int::Abs::execute(fixed);
+    const std::vector<std::uint8_t>& nums = fixed_abs.get().nums;
+
+    // Позиция p после запятой лежит в nums[digits - p], целая часть - выше digits.
+    std::uint64_t low = 0;
+    std::uint64_t high = 1;
+    while (low < digits) {
+        high = std::min(high, digits);
+        std::size_t from = static_cast<std::size_t>(digits - high);
+        std::size_t to = low == 0 ? nums.size() : static_cast<std::size_t>(digits - low);
+        std::vector<std::uint8_t> piece;
+        for (std::size_t i = from; i < to && i < nums.size(); ++i) piece.push_back(nums[i]);
+        if (!piece.empty()) {
+            Natural value(piece);
+            if (!value.isZero())
+                chunks.push_back({Z(value, fixed.is_neg), high});
+        }
+        low = high;
+        high *= 2;
+    }
+    return chunks;
+}
+
+// Члены рядов для куска x = u / 10^scale.
+inline Floating expChunk(const ArgumentChunk& chunk, std::uint64_t precision) {
+    Z denominator = Z(N(NatOper::powerOfTen(static_cast<std::size_t>(chunk.scale))));
+    auto term = [&chunk, &denominator](std::uint64_t n) -> SeriesTerm {
+        Z one(std::int64_t{1});
+        if (n == 0) return {one, one, one, one};
+        return {chunk.u, denominator.mulUi(n), one, one};
+    };
+    N u_abs = Int::Abs::execute(chunk.u.get());
+    long double log10_x = static_cast<long double>(u_abs.get().nums.size()) - static_cast<long double>(chunk.scale);
+    return sumSeries(termsForFactorialSeries(log10_x, precision), term, precision);
+}
+
+inline std::pair<Floating, Floating> sinCosChunk(const ArgumentChunk& chunk, std::uint64_t precision) {
+    Z denominator = Z(N(NatOper::powerOfTen(static_cast<std::size_t>(chunk.scale))));
+    Z u2 = -(chunk.u * chunk.u);
+    Z d2 = denominator * denominator;
+    auto sin_term = [&](std::uint64_t n) -> SeriesTerm {
+        Z one(std::int64_t{1});
+        if (n == 0) return {chunk.u, denominator, one, one};
+        return {u2, d2.mulUi(2 * n).mulUi(2 * n + 1), one, one};
+    };
+    auto cos_term = [&](std::uint64_t n) -> SeriesTerm {
+        Z one(std::int64_t{1});
+        if (n == 0) return {one, one, one, one};
+        return {u2, d2.mulUi(2 * n - 1).mulUi(2 * n), one, one};
+    };
+    N u_abs = Int::Abs::execute(chunk.u.get());
+    long double log10_x = static_cast<long double>(u_abs.get().nums.size()) - static_cast<long double>(chunk.scale);
+    std::uint64_t terms = termsForFactorialSeries(log10_x, precision, 2);
+    return {sumSeries(terms, sin_term, precision), sumSeries(terms, cos_term, precision)};
+}
+
+
+/**
+ * @brief Экспонента: x = n ln10 + r, exp(x) = 10^n exp(r), exp(r) - произведение экспонент кусков r.
+ */
+class Exp : public Mapping<Exp, Floating, Floating, std::uint64_t>
+{
+public:
+    static Floating calc(Floating x, std::uint64_t precision) {
+        if (x.mantissa.isZero()) return fromWord(1, precision);
+        if (topOf(x) > 18)
+            throw UniversalStringException("Floating: exp argument is too large");
+
+        std::uint64_t wp = precision + guard_digits;
+        long double approx = toLongDouble(x) / std::log(10.0L);
+        std::int64_t n = static_cast<std::int64_t>(std::floor(approx));
+
+        Floating r = x;
+        if (n != 0) {
+            std::uint64_t extra = static_cast<std::uint64_t>(std::to_string(n < 0 ? -n : n).size());
+            std::uint64_t rp = wp + extra + static_cast<std::uint64_t>(std::max<std::int64_t>(0, topOf(x)));
+            Floating shift = Mul::execute(fromWord(n, rp), ln10(rp), rp, RoundingMode::Nearest);
+            r = Sub::execute(x, shift, rp, RoundingMode::Nearest);
+        }
+
+        Floating result = fromWord(1, wp);
+        for (const ArgumentChunk& chunk : splitArgument(r, wp + 2)) {
+            result = Mul::execute(result, expChunk(chunk, wp), wp, RoundingMode::Nearest);
+        }
+        result.exponent += n;
+        return Round::execute(result, precision, RoundingMode::Nearest);
+    }
+};
+
+
+/**
+ * @brief sin и cos одновременно: x = n pi/2 + r, куски r собираются формулами сложения, затем четверть
+ * выбирается по n mod 4.
+ */
+inline std::pair<Floating, Floating> sinCos(const Floating& x, std::uint64_t precision) {
+    std::uint64_t wp = precision + guard_digits;
+    if (x.mantissa.isZero()) return {zero(precision), fromWord(1, precision)};
+
+    std::int64_t top = std::max<std::int64_t>(0, topOf(x));
+    std::uint64_t rp = wp + static_cast<std::uint64_t>(top);
+    Floating half_pi = Div::execute(pi(rp), fromWord(2, rp), rp, RoundingMode::Nearest);
+    Integer n = ToInteger::execute(Div::execute(x, half_pi, static_cast<std::uint64_t>(top) + 2, RoundingMode::Nearest),
+                                   RoundingMode::Nearest);
+    Floating r = x;
+    if (!Z(n).isZero()) {
+        // Около кратного pi/2 вычитание съедает старшие цифры, и r верен только до разряда 10^(top - rp).
+        // Точность приведения растет на глубину r, пока она не перестанет меняться.
+        while (true) {
+            Floating shift = Mul::execute(FromInteger::execute(n, rp, RoundingMode::Nearest), half_pi, rp, RoundingMode::Nearest);
+            r = Sub::execute(x, shift, rp, RoundingMode::Nearest);
+            std::uint64_t need = r.mantissa.isZero() ? rp + wp
+                                                     : wp + static_cast<std::uint64_t>(top + std::max<std::int64_t>(0, -topOf(r)));
+            if (need <= rp) break;
+            rp = need;
+            half_pi = Div::execute(pi(rp), fromWord(2, rp), rp, RoundingMode::Nearest);
+        }
+    }
+
+    // У малого r значимые цифры начинаются глубже, под них нужен запас разрядов после запятой.
+    std::uint64_t depth = wp + 2 + static_cast<std::uint64_t>(std::max<std::int64_t>(0, -topOf(r)));
+    Floating s = zero(wp);
+    Floating c = fromWord(1, wp);
+    for (const ArgumentChunk& chunk : splitArgument(r, depth)) {
+        auto [chunk_sin, chunk_cos] = sinCosChunk(chunk, wp);
+        Floating next_s = Add::execute(Mul::execute(s, chunk_cos, wp, RoundingMode::Nearest),
+                                       Mul::execute(c, chunk_sin, wp, RoundingMode::Nearest), wp, RoundingMode::Nearest);
+        Floating next_c = Sub::execute(Mul::execute(c, chunk_cos, wp, RoundingMode::Nearest),
+                                       Mul::execute(s, chunk_sin, wp, RoundingMode::Nearest), wp, RoundingMode::Nearest);
+        s = std::move(next_s);
+        c = std::move(next_c);
+    }
+
+    std::uint64_t quarter = Z(n).divmodUi(4).second;
+    Floating sin_x = s;
+    Floating cos_x = c;
+    if (quarter == 1) {
+        sin_x = c;
+        cos_x = negate(s);
+    } else if (quarter == 2) {
+        sin_x = negate(s);
+        cos_x = negate(c);
+    } else if (quarter == 3) {
+        sin_x = negate(c);
+        cos_x = s;
+    }
+    return {Round::execute(sin_x, precision, RoundingMode::Nearest), Round::execute(cos_x, precision, RoundingMode::Nearest)};
+}
+
+class Sin : public Mapping<Sin, Floating, Floating, std::uint64_t>
+{
+public:
+    static Floating calc(Floating x, std::uint64_t precision) { return sinCos(x, precision).first; }
+};
+
+class Cos : public Mapping<Cos, Floating, Floating, std::uint64_t>
+{
+public:
+    static Floating calc(Floating x, std::uint64_t precision) { return sinCos(x, precision).second; }
+};
+
+
+/**
+ * @brief Натуральный логарифм: x = y * 10^k, y в [1, 10), log y уточняется итерацией Галлея
+ * z <- z + 2 (y - e^z) / (y + e^z), которая утраивает число верных цифр.
+ */
+class Log : public Mapping<Log, Floating, Floating, std::uint64_t>
+{
+public:
+    static Floating calc(Floating x, std::uint64_t precision) {
+        if (x.mantissa.isZero() || x.is_neg)
+            throw UniversalStringException("Floating: logarithm of a non-positive number");
+
+        std::int64_t k = topOf(x) - 1;
+        Floating y = x;
+
+        // Около единицы логарифм мал, и его верные цифры начинаются на глубине цифр x - 1. При x чуть
+        // меньше 1 сдвиг на 10^k дал бы log(10 x) - ln 10 с потерей этих цифр, поэтому при |x - 1| < 0.1
+        // x не сдвигается (k = 0) ни с какой стороны от единицы.
+        std::uint64_t wp = precision + guard_digits;
+        Floating near_one = Sub::execute(x, fromWord(1, 1), 1, RoundingMode::Nearest);
+        if (!near_one.mantissa.isZero() && topOf(near_one) < 0) {
+            k = 0;
+            wp += static_cast<std::uint64_t>(-topOf(near_one));
+        }
+        y.exponent -= k;
+
+        Floating z = fromLongDouble(std::log(toLongDouble(y)), wp);
+        std::uint64_t known = 15;
+        while (true) {
+            std::uint64_t step = std::min<std::uint64_t>(wp, 3 * known);
+            Floating ez = Exp::execute(z, step);
+            Floating num = Sub::execute(y, ez, step, RoundingMode::Nearest);
+            Floating den = Add::execute(y, ez, step, RoundingMode::Nearest);
+            Floating delta = Div::execute(Mul::execute(fromWord(2, step), num, step, RoundingMode::Nearest), den, step,
+                                          RoundingMode::Nearest);
+            z = Add::execute(z, delta, step, RoundingMode::Nearest);
+            if (known >= wp) break;
+            known = step;
+        }
+
+        if (k != 0) {
+            std::uint64_t kp = wp + static_cast<std::uint64_t>(std::to_string(k < 0 ? -k : k).size());
+            Floating shift = Mul::execute(fromWord(k, kp), ln10(kp), kp, RoundingMode::Nearest);
+            z = Add::execute(z, shift, wp, RoundingMode::Nearest);
+        }
+        return Round::execute(z, precision, RoundingMode::Nearest);
+    }
+};
+
+
+/**
+ * @brief Арктангенс: при |x| > 1 atan x = sign(x) pi/2 - atan(1/x), иначе метод Ньютона для
+ * sin y - x cos y = 0 с удвоением точности.
+ */
+class Atan : public Mapping<Atan, Floating, Floating, std::uint64_t>
+{
+public:
+    static Floating calc(Floating x, std::uint64_t precision) {
+        if (x.mantissa.isZero()) return zero(precision);
+        std::uint64_t wp = precision + guard_digits;
+
+        bool negative = x.is_neg;
+        x.is_neg = false;
+        if (Cmp::execute(x, fromWord(1, wp)) == 2) {
+            Floating inner = calc(Div::execute(fromWord(1, wp), x, wp, RoundingMode::Nearest), wp);
+            Floating half_pi = Div::execute(pi(wp), fromWord(2, wp), wp, RoundingMode::Nearest);
+            Floating result = Sub::execute(half_pi, inner, precision, RoundingMode::Nearest);
+            return negative ? negate(result) : result;
+        }
+
+        Floating y = fromLongDouble(std::atan(toLongDouble(x)), wp);
+        std::uint64_t known = 15;
+        while (true) {
+            std::uint64_t step = std::min<std::uint64_t>(wp, 2 * known);
+            auto [s, c] = sinCos(y, step);
+            Floating f = Sub::execute(s, Mul::execute(x, c, step, RoundingMode::Nearest), step, RoundingMode::Nearest);
+            Floating df = Add::execute(c, Mul::execute(x, s, step, RoundingMode::Nearest), step, RoundingMode::Nearest);
+            y = Sub::execute(y, Div::execute(f, df, step, RoundingMode::Nearest), step, RoundingMode::Nearest);
+            if (known >= wp) break;
+            known = step;
+        }
+        Floating result = Round::execute(y, precision, RoundingMode::Nearest);
+        return negative ? negate(result) : result;
+    }
+};
+
+}
+
+#endif //ELEMENTARY_FLOATING_H
@@ -0,0 +1,343 @@
+#ifndef OPERATIONS_FLOATING_H
+#define OPERATIONS_FLOATING_H
+
+#include <algorithm>
+#include <string>
+
+#include "../../abstract/types/floating.h"
+#include "../../abstract/types/rational.h"
+
+#include "../../abstract/transformations/operations/unary.h"
+#include "../../abstract/transformations/operations/binary.h"
+
+#include "../Rational/operations.h"
+
+/**
+ * В данном файле арифметика чисел с плавающей точкой произвольной точности.
+ *
+ * Каждая операция сначала получает точный результат или его усечение, у которого цифр больше precision,
+ * плюс признак sticky - "за последней цифрой есть еще ненулевой хвост". Этого хватает, чтобы округлить
+ * корректно в любом режиме: результат совпадает с округлением точного значения (как в MPFR).
+ */
+
+namespace Flt {
+
+constexpr std::int64_t lengthOf(const Natural& num) {
+    return static_cast<std::int64_t>(num.nums.size());
+}
+
+constexpr Natural shiftLeft(Natural num, std::int64_t k) {
+    if (k <= 0) return num;
+    return NatOper::multiplyByPowerOfTen(num, static_cast<std::size_t>(k));
+}
+
+constexpr Floating zero(std::uint64_t precision) {
+    return Floating(N(std::uint64_t{0}), 0, false, precision);
+}
+
+/**
+ * @brief Отбрасывает drop младших разрядов m с округлением по режиму mode.
+ * sticky - у точного значения за младшим разрядом m есть ненулевой хвост. drop может превышать длину m.
+ */
+constexpr Natural dropDigits(const Natural& m, std::size_t drop, bool is_neg, bool sticky, RoundingMode mode) {
+    if (drop == 0 && !sticky) return m;
+
+    auto digit = [&m](std::size_t i) -> std::uint8_t { return i < m.nums.size() ? m.nums[i] : 0; };
+    std::uint8_t first = drop > 0 ? digit(drop - 1) : 0;
+    bool rest = sticky;
+    for (std::size_t i = 0; i + 1 < drop && i < m.nums.size() && !rest; ++i) {
+        rest = m.nums[i] != 0;
+    }
+
+    Natural kept(std::uint64_t{0});
+    if (drop < m.nums.size()) {
+        kept = Natural(std::vector<std::uint8_t>(m.nums.begin() + static_cast<std::ptrdiff_t>(drop), m.nums.end()));
+    }
+
+    bool inexact = first != 0 || rest;
+    bool increment = false;
+    switch (mode) {
+        case RoundingMode::Nearest:
+            increment = first > 5 || (first == 5 && (rest || (kept.nums[0] & 1)));
+            break;
+        case RoundingMode::TowardZero:
+            break;
+        case RoundingMode::TowardPositive:
+            increment = inexact && !is_neg;
+            break;
+        case RoundingMode::TowardNegative:
+            increment = inexact && is_neg;
+            break;
+        case RoundingMode::AwayFromZero:
+            increment = inexact;
+            break;
+    }
+    return increment ? NatOper::AddUi::execute(kept, 1) : kept;
+}
+
+/**
+ * @brief Округление m * 10^e (плюс хвост sticky) до precision значащих цифр, хвостовые нули мантиссы
+ * переносятся в порядок. Если sticky, у m должно быть больше precision цифр.
+ */
+constexpr Floating round(const Natural& m, std::int64_t e, bool is_neg, bool sticky, std::uint64_t precision,
+                         RoundingMode mode) {
+    if (m.isZero() && !sticky) return zero(precision);
+
+    std::int64_t len = lengthOf(m);
+    std::int64_t drop = std::max<std::int64_t>(0, len - static_cast<std::int64_t>(precision));
+    Natural kept = dropDigits(m, static_cast<std::size_t>(drop), is_neg, sticky, mode);
+    e += drop;
+
+    // Перенос при округлении 99..9 -> 100..0 дает лишнюю цифру, она уйдет вместе с нулями ниже.
+    std::size_t zeros = 0;
+    while (zeros + 1 < kept.nums.size() && kept.nums[zeros] == 0) ++zeros;
+    if (zeros > 0) {
+        kept = Natural(std::vector<std::uint8_t>(kept.nums.begin() + static_cast<std::ptrdiff_t>(zeros), kept.nums.end()));
+        e += static_cast<std::int64_t>(zeros);
+    }
+    return Floating(N(std::move(kept)), e, is_neg, precision);
+}
+
+
+/**
+ * @brief Округление числа до новой точности.
+ */
+class Round : public Mapping<Round, Floating, Floating, std::uint64_t, RoundingMode>
+{
+public:
+    static constexpr Floating calc(Floating num, std::uint64_t precision, RoundingMode mode) {
+        return round(num.mantissa.get(), num.exponent, num.is_neg, false, precision, mode);
+    }
+};
+
+
+/**
+ * @brief Сравнение, коды как у остальных типов: 0 - равны, 1 - меньше, 2 - больше.
+ */
+class Cmp : public Mapping<Cmp, int, Floating, Floating>
+{
+public:
+    static constexpr int calc(Floating num1, Floating num2) {
+        int sign1 = num1.mantissa.isZero() ? 0 : (num1.is_neg ? -1 : 1);
+        int sign2 = num2.mantissa.isZero() ? 0 : (num2.is_neg ? -1 : 1);
+        if (sign1 != sign2) return sign1 < sign2 ? 1 : 2;
+        if (sign1 == 0) return 0;
+
+        // Мантиссы без ведущих нулей, поэтому сначала сравниваем позицию старшей цифры.
+        const Natural& m1 = num1.mantissa.get();
+        const Natural& m2 = num2.mantissa.get();
+        std::int64_t top1 = num1.exponent + lengthOf(m1);
+        std::int64_t top2 = num2.exponent + lengthOf(m2);
+        int magnitude;
+        if (top1 != top2) {
+            magnitude = top1 > top2 ? 2 : 1;
+        } else {
+            std::int64_t e = std::min(num1.exponent, num2.exponent);
+            magnitude = NatOper::Cmp::execute(shiftLeft(m1, num1.exponent - e), shiftLeft(m2, num2.exponent - e));
+        }
+        if (magnitude == 0) return 0;
+        return sign1 > 0 ? magnitude : 3 - magnitude;
+    }
+};
+
+
+/**
+ * @brief Сложение с округлением до precision цифр.
+ *
+ * Если младший операнд целиком лежит ниже разряда округления старшего, он заменяется на "хвост": точная
+ * сумма не строится, а у старшего операнда дописываются guard-цифры и ставится sticky. Иначе операнды
+ * выравниваются и складываются точно.
+ */
+class Add : public Mapping<Add, Floating, Floating, Floating, std::uint64_t, RoundingMode>
+{
+public:
+    static constexpr Floating calc(Floating num1, Floating num2, std::uint64_t precision, RoundingMode mode) {
+        if (num2.mantissa.isZero()) return Round::execute(num1, precision, mode);
+        if (num1.mantissa.isZero()) return Round::execute(num2, precision, mode);
+
+        std::int64_t top1 = num1.exponent + lengthOf(num1.mantissa.get());
+        std::int64_t top2 = num2.exponent + lengthOf(num2.mantissa.get());
+        if (top1 < top2 || (top1 == top2 && num1.exponent > num2.exponent))
+            std::swap(num1, num2);
+
+        const Natural& big = num1.mantissa.get();
+        const Natural& small = num2.mantissa.get();
+        std::int64_t top_big = num1.exponent + lengthOf(big);
+        std::int64_t top_small = num2.exponent + lengthOf(small);
+        std::int64_t guard = static_cast<std::int64_t>(precision) + 2;
+
+        if (top_small <= num1.exponent && top_small < top_big - guard) {
+            std::int64_t pad = std::max<std::int64_t>(0, guard - lengthOf(big));
+            Natural padded = shiftLeft(big, pad);
+            if (num1.is_neg != num2.is_neg)
+                padded = NatOper::Sub::execute(padded, Natural(std::uint64_t{1}));
+            return round(padded, num1.exponent - pad, num1.is_neg, true, precision, mode);
+        }
+
+        std::int64_t e = std::min(num1.exponent, num2.exponent);
+        Natural a = shiftLeft(big, num1.exponent - e);
+        Natural b = shiftLeft(small, num2.exponent - e);
+        if (num1.is_neg == num2.is_neg)
+            return round(NatOper::Add::execute(a, b), e, num1.is_neg, false, precision, mode);
+
+        int cmp = NatOper::Cmp::execute(a, b);
+        if (cmp == 0) return zero(precision);
+        if (cmp == 2)
+            return round(NatOper::Sub::execute(a, b), e, num1.is_neg, false, precision, mode);
+        return round(NatOper::Sub::execute(b, a), e, num2.is_neg, false, precision, mode);
+    }
+};
+
+/**
+ * @brief Вычитание с округлением.
+ */
+class Sub : public Mapping<Sub, Floating, Floating, Floating, std::uint64_t, RoundingMode>
+{
+public:
+    static constexpr Floating calc(Floating num1, Floating num2, std::uint64_t precision, RoundingMode mode) {
+        if (!num2.mantissa.isZero()) num2.is_neg = !num2.is_neg;
+        return Add::execute(num1, num2, precision, mode);
+    }
+};
+
+
+/**
+ * @brief Умножение с округлением: произведение мантисс точное, округляется один раз.
+ */
+class Mul : public Mapping<Mul, Floating, Floating, Floating, std::uint64_t, RoundingMode>
+{
+public:
+    static constexpr Floating calc(Floating num1, Floating num2, std::uint64_t precision, RoundingMode mode) {
+        Natural product = NatOper::Mul::execute(num1.mantissa.get(), num2.mantissa.get());
+        return round(product, num1.exponent + num2.exponent, num1.is_neg != num2.is_neg, false, precision, mode);
+    }
+};
+
+
+/**
+ * @brief Корректно округленное a / b * 10^e: частное берется минимум с precision + 1 цифрами,
+ * ненулевой остаток становится sticky.
+ */
+constexpr Floating divide(const Natural& a, const Natural& b, std::int64_t e, bool is_neg, std::uint64_t precision,
+                          RoundingMode mode) {
+    std::int64_t k = std::max<std::int64_t>(0, static_cast<std::int64_t>(precision) + 1 + lengthOf(b) - lengthOf(a));
+    auto [quotient, remainder] = NatOper::divideWithRemainder(shiftLeft(a, k), b);
+    return round(quotient, e - k, is_neg, !remainder.isZero(), precision, mode);
+}
+
+/**
+ * @brief Деление с корректным округлением.
+ */
+class Div : public Mapping<Div, Floating, Floating, Floating, std::uint64_t, RoundingMode>
+{
+public:
+    static constexpr Floating calc(Floating num1, Floating num2, std::uint64_t precision, RoundingMode mode) {
+        if (num2.mantissa.isZero())
+            throw UniversalStringException("Floating: cannot divide by zero");
+        if (num1.mantissa.isZero()) return zero(precision);
+        return divide(num1.mantissa.get(), num2.mantissa.get(), num1.exponent - num2.exponent,
+                      num1.is_neg != num2.is_neg, precision, mode);
+    }
+};
+
+
+/**
+ * @brief Квадратный корень с корректным округлением: целый корень из мантиссы, дополненной нулями
+ * до 2 * precision + 2 цифр и четного порядка.
+ */
+class Sqrt : public Mapping<Sqrt, Floating, Floating, std::uint64_t, RoundingMode>
+{
+public:
+    static constexpr Floating calc(Floating num, std::uint64_t precision, RoundingMode mode) {
+        if (num.mantissa.isZero()) return zero(precision);
+        if (num.is_neg)
+            throw UniversalStringException("Floating: square root of a negative number");
+
+        const Natural& m = num.mantissa.get();
+        std::int64_t k = std::max<std::int64_t>(0, 2 * static_cast<std::int64_t>(precision) + 2 - lengthOf(m));
+        if ((num.exponent - k) % 2 != 0) ++k;
+        Natural scaled = shiftLeft(m, k);
+        Natural root = NatOper::ISqrt::execute(scaled);
+        bool sticky = NatOper::Cmp::execute(NatOper::Sqr::execute(root), scaled) != 0;
+        return round(root, (num.exponent - k) / 2, false, sticky, precision, mode);
+    }
+};
+
+
+/**
+ * @brief Целое число с округлением до precision цифр (при достаточной точности - точно).
+ */
+class FromInteger : public Mapping<FromInteger, Floating, Integer, std::uint64_t, RoundingMode>
+{
+public:
+    static constexpr Floating calc(Integer num, std::uint64_t precision, RoundingMode mode) {
+        N abs = Int::Abs::execute(num);
+        return round(abs.get(), 0, num.is_neg, false, precision, mode);
+    }
+};
+
+/**
+ * @brief Рациональное число с корректным округлением.
+ */
+class FromRational : public Mapping<FromRational, Floating, Rational, std::uint64_t, RoundingMode>
+{
+public:
+    static constexpr Floating calc(Rational num, std::uint64_t precision, RoundingMode mode) {
+        if (num.numerator.isZero()) return zero(precision);
+        N abs = Z::abs(num.numerator);
+        return divide(abs.get(), num.denominator.get(), 0, num.numerator.isNegative(), precision, mode);
+    }
+};
+
+/**
+ * @brief Точное значение в виде несократимой дроби.
+ */
+class ToRational : public Mapping<ToRational, Rational, Floating>
+{
+public:
+    static constexpr Rational calc(Floating num) {
+        const Natural& m = num.mantissa.get();
+        if (num.exponent >= 0)
+            return Rational(Z(shiftLeft(m, num.exponent), num.is_neg), N(std::uint64_t{1}));
+        return Rat::Red::execute(Rational(Z(m, num.is_neg), N(NatOper::powerOfTen(static_cast<std::size_t>(-num.exponent)))));
+    }
+};
+
+/**
+ * @brief Округление до целого по режиму mode.
+ */
+class ToInteger : public Mapping<ToInteger, Integer, Floating, RoundingMode>
+{
+public:
+    static constexpr Integer calc(Floating num, RoundingMode mode) {
+        const Natural& m = num.mantissa.get();
+        if (num.exponent >= 0)
+            return Integer(N(shiftLeft(m, num.exponent)), num.is_neg);
+        Natural kept = dropDigits(m, static_cast<std::size_t>(-num.exponent), num.is_neg, false, mode);
+        return Integer(N(std::move(kept)), num.is_neg);
+    }
+};
+
+
+/**
+ * @brief Запись в экспоненциальной форме: -1.2345e-7.
+ */
+class toString : public Mapping<toString, std::string, Floating>
+{
+public:
+    static std::string calc(Floating num) {
+        if (num.mantissa.isZero()) return "0";
+        std::string digits = NatOper::toString::execute(num.mantissa.get());
+        std::string result = num.is_neg ? "-" : "";
+        result += digits[0];
+        if (digits.size() > 1) {
+            result += ".";
+            result += digits.substr(1);
+        }
+        return result + "e" + std::to_string(num.exponent + static_cast<std::int64_t>(digits.size()) - 1);
+    }
+};
+
+}
+
+#endif //OPERATIONS_FLOATING_H
@@ -0,0 +1,158 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+#include "../Natural/N.h"
+#include "../Integer/Z.h"
+#include "../Rational/Q.h"
+#include "../Polynomial/P[x].h"
+#include "../../abstract/structures/factor.h"
+
+/**
+ * В данном файле хэширование всех числовых типов ядра и специализации std::hash для них, чтобы их можно
+ * было класть в unordered_map/unordered_set (кэши, мемоизация, дедупликация).
+ *
+ * Хэш считается один раз и запоминается прямо в объекте (ячейка HashCache), копии объекта забирают его
+ * вместе со значением. Равные значения всегда дают равный хэш: Integer хранится в канонической форме,
+ * у Rational хэшируется сокращенная дробь, у Polynomial нет ведущих нулей.
+ */
+
+namespace Hashing {
+
+// Перемешивание 64-битного слова (финализатор splitmix64).
+constexpr std::uint64_t mix(std::uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+constexpr std::uint64_t combine(std::uint64_t seed, std::uint64_t value) {
+    return mix(seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)));
+}
+
+// Ноль в кэше означает "не посчитан", поэтому настоящий нулевой хэш сдвигаем.
+constexpr std::size_t nonZero(std::uint64_t h) {
+    return h == 0 ? 1 : static_cast<std::size_t>(h);
+}
+
+/**
+ * @brief Хэш натурального числа, разряды перемешиваются пачками по 8 штук.
+ */
+inline std::size_t hashOf(const Natural& num) {
+    if (num.hash_cache.value != 0)
+        return num.hash_cache.value;
+
+    std::uint64_t h = mix(num.nums.size());
+    for (size_t i = 0; i < num.nums.size(); i += 8) {
+        std::uint64_t chunk = 0;
+        for (size_t j = i; j < num.nums.size() && j < i + 8; ++j) {
+            chunk = (chunk << 8) | num.nums[j];
+        }
+        h = combine(h, chunk);
+    }
+    num.hash_cache.value = nonZero(h);
+    return num.hash_cache.value;
+}
+
+/**
+ * @brief Хэш целого числа. Малые числа хэшируются за O(1), у больших берется закэшированный хэш модуля.
+ */
+inline std::size_t hashOf(const Integer& num) {
+    if (num.is_small)
+        return nonZero(mix(static_cast<std::uint64_t>(num.small)));
+    return nonZero(combine(hashOf(num.natural.get()), num.is_neg ? 1 : 2));
+}
+
+/**
+ * @brief Хэш рационального числа, считается по сокращенной дроби, чтобы 1/2 и 2/4 совпадали.
+ */
+inline std::size_t hashOf(const Rational& num) {
+    if (num.hash_cache.value != 0)
+        return num.hash_cache.value;
+
+    if (num.denominator.isOne()) {
+        num.hash_cache.value = nonZero(combine(hashOf(num.numerator.get()), hashOf(num.denominator.get())));
+    } else {
+        Rational reduced = Rat::Red::execute(num);
+        num.hash_cache.value = nonZero(combine(hashOf(reduced.numerator.get()), hashOf(reduced.denominator.get())));
+    }
+    return num.hash_cache.value;
+}
+
+/**
+ * @brief Хэш полинома - свертка хэшей коэффициентов.
+ */
+template<typename T>
+std::size_t hashOf(const Polynomial<T>& poly) {
+    if (poly.hash_cache.value != 0)
+        return poly.hash_cache.value;
+
+    std::uint64_t h = mix(poly.coefficients.size());
+    for (const T& coeff : poly.coefficients) {
+        h = combine(h, std::hash<T>{}(coeff));
+    }
+    poly.hash_cache.value = nonZero(h);
+    return poly.hash_cache.value;
+}
+
+}
+
+
+template<>
+struct std::hash<Natural> {
+    std::size_t operator()(const Natural& num) const { return Hashing::hashOf(num); }
+};
+
+template<>
+struct std::hash<Integer> {
+    std::size_t operator()(const Integer& num) const { return Hashing::hashOf(num); }
+};
+
+template<>
+struct std::hash<Rational> {
+    std::size_t operator()(const Rational& num) const { return Hashing::hashOf(num); }
+};
+
+template<typename T>
+struct std::hash<Polynomial<T>> {
+    std::size_t operator()(const Polynomial<T>& poly) const { return Hashing::hashOf(poly); }
+};
+
+template<>
+struct std::hash<N> {
+    std::size_t operator()(const N& num) const { return Hashing::hashOf(num.get()); }
+};
+
+template<>
+struct std::hash<Z> {
+    std::size_t operator()(const Z& num) const { return Hashing::hashOf(num.get()); }
+};
+
+template<>
+struct std::hash<Q> {
+    std::size_t operator()(const Q& num) const { return Hashing::hashOf(num.get()); }
+};
+
+template<typename T>
+struct std::hash<P<T>> {
+    std::size_t operator()(const P<T>& poly) const { return Hashing::hashOf(poly.get()); }
+};
+
+// Представитель класса вычетов канонический, поэтому достаточно хэшировать его.
+template<typename R, typename I>
+struct std::hash<FactorRing<R, I>> {
+    std::size_t operator()(const FactorRing<R, I>& elem) const { return std::hash<R>{}(elem.get()); }
+};
+
+template<typename R, typename I>
+struct std::hash<FactorField<R, I>> {
+    std::size_t operator()(const FactorField<R, I>& elem) const { return std::hash<R>{}(elem.get()); }
+};
+
+#endif // HASH_H
@@ -0,0 +1,87 @@
+#ifndef INTERN_H
+#define INTERN_H
+
+#include <mutex>
+#include <unordered_set>
+
+#include "hash.h"
+
+/**
+ * В данном файле таблица интернирования (hash-consing) значений. Повторяющиеся большие константы
+ * хранятся в таблице в единственном неизменяемом экземпляре, а пользователь получает легкий дескриптор
+ * Interned<T>. Равенство дескрипторов - это сравнение указателей, хэш - уже посчитанный хэш значения.
+ *
+ * Таблица ничего не удаляет: она рассчитана на константы, которые живут до конца программы.
+ *
+ * @code
+ * Interned<N> a = intern(N(...));
+ * Interned<N> b = intern(N(...));   // то же значение
+ * a == b;                           // сравнение указателей, без прохода по разрядам
+ * @endcode
+ */
+
+
+template<typename T>
+class InternTable;
+
+/**
+ * @brief Дескриптор интернированного значения.
+ */
+template<typename T>
+class Interned {
+private:
+    const T* ptr;
+
+    explicit Interned(const T* p) : ptr(p) {}
+    friend class InternTable<T>;
+
+public:
+    const T& get() const { return *ptr; }
+    const T& operator*() const { return *ptr; }
+    const T* operator->() const { return ptr; }
+
+    bool operator==(const Interned& other) const { return ptr == other.ptr; }
+};
+
+
+/**
+ * @brief Таблица интернирования значений типа T, по одной на тип.
+ * Узлы unordered_set не переезжают при перехешировании, поэтому указатели на элементы стабильны.
+ */
+template<typename T>
+class InternTable {
+private:
+    std::unordered_set<T> values;
+    mutable std::mutex lock;
+
+public:
+    static InternTable& instance() {
+        static InternTable table;
+        return table;
+    }
+
+    Interned<T> intern(const T& value) {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = values.insert(value).first;
+        return Interned<T>(&*it);
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return values.size();
+    }
+};
+
+
+template<typename T>
+Interned<T> intern(const T& value) {
+    return InternTable<T>::instance().intern(value);
+}
+
+
+template<typename T>
+struct std::hash<Interned<T>> {
+    std::size_t operator()(const Interned<T>& handle) const { return std::hash<T>{}(handle.get()); }
+};
+
+#endif // INTERN_H
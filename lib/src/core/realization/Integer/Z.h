@@ -24,64 +24,161 @@ public:
     using MultiplicationOp = Int::Mul;
 	using SetType = Integer;
 
-    Z(Integer v) : value(std::move(v)) {}
-    Z(Natural num, bool is_neg) : value(num, is_neg) {}
-    Z(N num) : value(num.get(), false) {}
+    constexpr Z(Integer v) : value(std::move(v)) {}
+    constexpr Z(Natural num, bool is_neg) : value(num, is_neg) {}
+    constexpr Z(N num) : value(num.get(), false) {}
 
-    Z operator-() {
+    constexpr explicit Z(std::int64_t v) : value(v) {}
+
+    constexpr Z operator-() const {
         return Int::Neg::execute(value);
     }
 
-    Z operator+(const Z& other) const { 
+    constexpr Z operator+(const Z& other) const { 
         return Z(Int::Add::execute(value, other.value));
     }
 
-    Z operator*(const Z& other) const {
+    constexpr Z operator*(const Z& other) const {
         return Z(Int::Mul::execute(value, other.value));
     }
 
-    Z operator-(const Z& other) const {
+    constexpr Z operator-(const Z& other) const {
         return Z(Int::Sub::execute(value, other.value));
     }
 
-    Z operator/(const Z& other) const {
+    constexpr Z operator/(const Z& other) const {
         return Z(Int::Div::execute(value, other.value));
     }
 
-    Z operator%(const Z& other) const {
+    constexpr Z operator%(const Z& other) const {
         return Z(Int::Rem::execute(value, other.value));
     }
 
-    bool operator>(const Z& other) const {
+    constexpr bool operator>(const Z& other) const {
         return Int::Cmp::execute(value, other.value) == 2;
     }
 
-    bool operator<(const Z& other) const {
+    constexpr bool operator<(const Z& other) const {
         return Int::Cmp::execute(value, other.value) == 1;
     }
 
-    bool operator==(const Z& other) const {
+    constexpr bool operator==(const Z& other) const {
         return Int::Cmp::execute(value, other.value) == 0;
     }
 
-    static Z gcd(const Z& a, const Z& b) {
+    static constexpr Z gcd(const Z& a, const Z& b) {
         return Z(Int::Gcd::execute(a.get(), b.get()));
     }
 
-    static Z lcm(const Z& a, const Z& b) {
+    static constexpr Z lcm(const Z& a, const Z& b) {
         return Z(Int::Lcm::execute(a.get(), b.get()));
     }
 
-    static N abs(Z&a) {
+    static constexpr N abs(Z&a) {
         return Int::Abs::execute(a.get());
     }
 
-    bool isNegative() const { return value.is_neg; }
+    constexpr bool isNegative() const { return value.is_neg; }
+
+    // Операции с машинным словом.
+    constexpr Z addUi(std::uint64_t b) const {
+        return Z(Int::AddUi::execute(value, b));
+    }
+
+    constexpr Z mulUi(std::uint64_t b) const {
+        return Z(Int::MulUi::execute(value, b));
+    }
+
+    constexpr std::pair<Z, std::uint64_t> divmodUi(std::uint64_t b) const {
+        auto [quotient, rem] = Int::DivModUi::execute(value, b);
+        return {Z(std::move(quotient)), rem};
+    }
+
+    constexpr int cmpUi(std::uint64_t b) const {
+        return Int::CmpUi::execute(value, b);
+    }
+
+    // Малый вид канонический, поэтому из больших в int64_t помещается только INT64_MIN.
+    constexpr bool fitsInt64() const {
+        if (value.is_small) return true;
+        return value.is_neg && value.natural.cmpUi(static_cast<std::uint64_t>(INT64_MAX) + 1) == 0;
+    }
+
+    constexpr std::int64_t toInt64() const {
+        if (!fitsInt64())
+            throw UniversalStringException("Integer: the number does not fit into int64_t");
+        return value.is_small ? value.small : INT64_MIN;
+    }
+
+    constexpr std::uint64_t toUInt64() const {
+        if (value.is_neg)
+            throw UniversalStringException("Integer: negative number can not be converted to uint64_t");
+        if (value.is_small)
+            return static_cast<std::uint64_t>(value.small);
+        return value.natural.toUInt64();
+    }
+
+    // Степени и корни.
+    constexpr Z powUi(std::uint64_t k) const {
+        return Z(Int::PowUi::execute(value, k));
+    }
+
+    constexpr Z isqrt() const {
+        return Z(Int::ISqrt::execute(value));
+    }
+
+    constexpr Z iroot(std::uint64_t k) const {
+        return Z(Int::IRoot::execute(value, k));
+    }
+
+    constexpr bool isPerfectSquare() const { return Int::IsPerfectSquare::execute(value); }
+    constexpr bool isPerfectPower() const { return Int::IsPerfectPower::execute(value); }
 
-    static Z zero() { return Z(Natural({0}), false); }
-    static Z identity() { return Z(Natural({1}), false); }  // Единица
+    constexpr std::pair<Z, std::uint64_t> perfectPower() const {
+        auto [root, exponent] = Int::PerfectPower::execute(value);
+        return {Z(std::move(root)), exponent};
+    }
+
+    // Комбинаторика.
+    static constexpr Z factorial(std::uint64_t n) {
+        return Z(N::factorial(n));
+    }
+
+    static constexpr Z binomial(const Z& n, std::uint64_t k) {
+        return Z(Int::Binomial::execute(n.get(), k));
+    }
+
+    static constexpr Z multinomial(const std::vector<std::uint64_t>& ks) {
+        return Z(N::multinomial(ks));
+    }
+
+    constexpr Z risingFactorial(std::uint64_t k) const {
+        return Z(Int::RisingFactorial::execute(value, k));
+    }
+
+    constexpr Z fallingFactorial(std::uint64_t k) const {
+        return Z(Int::FallingFactorial::execute(value, k));
+    }
 
-    const Integer& get() const { return value; }
+    // Простыми считаются только положительные числа.
+    constexpr bool isProbablePrime() const {
+        return !value.is_neg && Int::Abs::execute(value).isProbablePrime();
+    }
+
+    constexpr bool isZero() const { return value.is_small && value.small == 0; }
+    constexpr bool isOne() const { return value.is_small && value.small == 1; }
+
+    static const Z& zero() {
+        static const Z instance(std::int64_t{0});
+        return instance;
+    }
+
+    static const Z& identity() {  // Единица
+        static const Z instance(std::int64_t{1});
+        return instance;
+    }
+
+    constexpr const Integer& get() const { return value; }
 
     std::string toString()const {
         return Int::toString::execute(value);
@@ -89,6 +186,14 @@ public:
 };
 
 
+/**
+ * @brief Литерал целого числа: 5_Z, -5_Z (минус - это обычный унарный оператор).
+ */
+constexpr Z operator""_Z(const char* literal) {
+    return Z(operator""_N(literal));
+}
+
+
 
 /**
  * Пример использования в полиноме:
@@ -2,6 +2,8 @@
 #define OPERATIONS_INTEGER_H
 
 
+#include <numeric>
+
 #include "../../abstract/types/integer.h"
 #include "../Natural/N.h"
 
@@ -11,21 +13,28 @@
 
 namespace Int {
 
+// Модуль малого числа. INT64_MIN в малом виде не бывает, так что переполнения нет.
+constexpr std::uint64_t smallAbs(std::int64_t v) {
+    return v < 0 ? static_cast<std::uint64_t>(-v) : static_cast<std::uint64_t>(v);
+}
+
 /**
  * @brief Оператор модуля в целых чиселах
  */
 class Abs : public Mapping<Abs, N, Integer>
 {
 public:
-    static N calc(Integer num) { 
+    static constexpr N calc(Integer num) { 
+        if (num.is_small)
+            return N(smallAbs(num.small));
         return num.natural;
     }
 };
 
 
-// Вспомогательная функция для целых чисел
-inline uint8_t getSign(Integer num) {
-    if (!(num.natural != N({0})))
+// Вспомогательная функция для целых чисел, большое число никогда не равно нулю.
+constexpr uint8_t getSign(const Integer& num) {
+    if (num.is_small && num.small == 0)
         return 0;
     return num.is_neg ? 1 : 2;
 }
@@ -37,7 +46,9 @@ inline uint8_t getSign(Integer num) {
 class Neg : public UnaryOperation<Neg, Integer>
 {
 public:
-    static Integer calc(Integer num) { 
+    static constexpr Integer calc(Integer num) { 
+        if (num.is_small)
+            return Integer(-num.small);
         return Integer(num.natural, !num.is_neg);
     }
 };
@@ -54,7 +65,11 @@ class Add : public BinaryOperation<Add, Integer>,
             public Inverse
 {
 public:
-    static Integer calc(Integer num1, Integer num2) { 
+    static constexpr Integer calc(Integer num1, Integer num2) { 
+        std::int64_t sum_small;
+        if (num1.is_small && num2.is_small && !__builtin_add_overflow(num1.small, num2.small, &sum_small))
+            return Integer(sum_small);
+
         N abs_this = Abs::execute(num1);
         N abs_other = Abs::execute(num2);
         
@@ -65,7 +80,7 @@ public:
 
 
             if (abs_this == abs_other){
-                return Integer(N({0}), false);
+                return Integer(std::int64_t{0});
             } else if (abs_this > abs_other) {
                 N diff = abs_this - abs_other;
                 return Integer(diff, num1.is_neg);
@@ -87,12 +102,16 @@ class Mul : public BinaryOperation<Mul, Integer>,
             public Identity
 {
 public:
-    static Integer calc(Integer num1, Integer num2) { 
+    static constexpr Integer calc(Integer num1, Integer num2) { 
+        std::int64_t product_small;
+        if (num1.is_small && num2.is_small && !__builtin_mul_overflow(num1.small, num2.small, &product_small))
+            return Integer(product_small);
+
         uint8_t sign_this = getSign(num1);
         uint8_t sign_other = getSign(num2);
         
         if (sign_this == 0 || sign_other == 0)
-            return Integer(N({0}), false);
+            return Integer(std::int64_t{0});
         
         N abs_this = Abs::execute(num1);
         N abs_other = Abs::execute(num2);
@@ -110,7 +129,11 @@ public:
 class Sub : public BinaryOperation<Sub, Integer>
 {
 public:
-    static Integer calc(Integer num1, Integer num2) { 
+    static constexpr Integer calc(Integer num1, Integer num2) { 
+        std::int64_t diff_small;
+        if (num1.is_small && num2.is_small && !__builtin_sub_overflow(num1.small, num2.small, &diff_small))
+            return Integer(diff_small);
+
         Integer neg_other = Neg::execute(num2);
         return Add::execute(num1, neg_other);
     }
@@ -122,15 +145,19 @@ public:
 class Div : public BinaryOperation<Div, Integer>
 {
 public:
-    static Integer calc(Integer num1, Integer num2) { 
+    static constexpr Integer calc(Integer num1, Integer num2) { 
         if (getSign(num2) == 0)
             throw UniversalStringException("Integer:  cannot divide by zero");
+
+        // Встроенное деление округляет к нулю, как и общий случай ниже.
+        if (num1.is_small && num2.is_small)
+            return Integer(num1.small / num2.small);
     
         N dividend = Abs::execute(num1);
         N divisor = Abs::execute(num2);
         
         if (divisor > dividend)
-            return Integer(N({0}), false);
+            return Integer(std::int64_t{0});
         
         N quotient = dividend / divisor;
         Integer result(quotient, false);
@@ -145,9 +172,16 @@ public:
 class Rem : public BinaryOperation<Rem, Integer>
 {
 public:
-    static Integer calc(Integer num1, Integer num2) { 
+    static constexpr Integer calc(Integer num1, Integer num2) { 
         if (getSign(num2) == 0)
             throw UniversalStringException("Integer: cannot divide by zero");
+
+        if (num1.is_small && num2.is_small) {
+            std::int64_t rem = num1.small % num2.small;
+            if (rem < 0)
+                rem += num2.small < 0 ? -num2.small : num2.small;
+            return Integer(rem);
+        }
     
         N dividend_abs = Abs::execute(num1);
         N divisor_abs = Abs::execute(num2);
@@ -177,8 +211,11 @@ public:
 class Gcd : public BinaryOperation<Gcd, Integer>
 {
 public:
-    static Integer calc(Integer num1, Integer num2) { 
-       return Integer(N::gcd(Abs::execute(num1), Abs::execute(num2)), false);
+    static constexpr Integer calc(Integer num1, Integer num2) { 
+        if (num1.is_small && num2.is_small && (num1.small != 0 || num2.small != 0))
+            return Integer(static_cast<std::int64_t>(std::gcd(smallAbs(num1.small), smallAbs(num2.small))));
+
+        return Integer(N::gcd(Abs::execute(num1), Abs::execute(num2)), false);
     }
 };
 
@@ -188,7 +225,7 @@ public:
 class Lcm : public BinaryOperation<Lcm, Integer>
 {
 public:
-    static Integer calc(Integer num1, Integer num2) { 
+    static constexpr Integer calc(Integer num1, Integer num2) { 
         return Integer(N::lcm(Abs::execute(num1), Abs::execute(num2)), false);
     }
 };
@@ -199,13 +236,27 @@ public:
 class Cmp : public Mapping<Cmp, int, Integer, Integer>
 {
 public:
-    static int calc(Integer num1, Integer num2) { 
+    static constexpr int calc(Integer num1, Integer num2) { 
+        if (num1.is_small && num2.is_small) {
+            if (num1.small > num2.small) return 2;
+            if (num1.small < num2.small) return 1;
+            return 0;
+        }
+
         bool sign1 = num1.is_neg;
         bool sign2 = num2.is_neg;
 
         if (!sign1 && sign2) return 2;  
         if (sign1 && !sign2) return 1;  
 
+        // Знаки совпали, и ровно одно число большое - по модулю оно больше.
+        if (num1.is_small != num2.is_small) {
+            bool abs1_greater = num2.is_small;
+            if (!sign1)
+                return abs1_greater ? 2 : 1;
+            return abs1_greater ? 1 : 2;
+        }
+
         N abs1 = Abs::execute(num1);
         N abs2 = Abs::execute(num2);
 
@@ -222,6 +273,201 @@ public:
     }
 };
 
+/**
+ * @brief Сложение целого числа с машинным словом.
+ */
+class AddUi : public Mapping<AddUi, Integer, Integer, std::uint64_t>
+{
+public:
+    static constexpr Integer calc(Integer num, std::uint64_t b) {
+        std::int64_t sum_small;
+        if (num.is_small && b <= static_cast<std::uint64_t>(INT64_MAX) &&
+            !__builtin_add_overflow(num.small, static_cast<std::int64_t>(b), &sum_small))
+            return Integer(sum_small);
+
+        N abs = Abs::execute(num);
+        if (!num.is_neg)
+            return Integer(abs.addUi(b), false);
+
+        if (abs.cmpUi(b) == 2)
+            return Integer(abs - N(b), true);
+
+        return Integer(N(b - abs.toUInt64()), false);
+    }
+};
+
+/**
+ * @brief Умножение целого числа на машинное слово.
+ */
+class MulUi : public Mapping<MulUi, Integer, Integer, std::uint64_t>
+{
+public:
+    static constexpr Integer calc(Integer num, std::uint64_t b) {
+        std::int64_t product_small;
+        if (num.is_small && b <= static_cast<std::uint64_t>(INT64_MAX) &&
+            !__builtin_mul_overflow(num.small, static_cast<std::int64_t>(b), &product_small))
+            return Integer(product_small);
+
+        return Integer(Abs::execute(num).mulUi(b), num.is_neg);
+    }
+};
+
+/**
+ * @brief Деление с остатком целого числа на машинное слово.
+ * Частное округляется вниз, поэтому остаток всегда лежит в [0, b), как и у Rem.
+ */
+class DivModUi : public Mapping<DivModUi, std::pair<Integer, std::uint64_t>, Integer, std::uint64_t>
+{
+public:
+    static constexpr std::pair<Integer, std::uint64_t> calc(Integer num, std::uint64_t b) {
+        auto [quotient, rem] = Abs::execute(num).divmodUi(b);
+        if (!num.is_neg)
+            return {Integer(quotient, false), rem};
+        if (rem == 0)
+            return {Integer(quotient, true), 0};
+        return {Integer(quotient.addUi(1), true), b - rem};
+    }
+};
+
+/**
+ * @brief Сравнение целого числа с машинным словом, результат в тех же кодах, что и у Cmp.
+ */
+class CmpUi : public Mapping<CmpUi, int, Integer, std::uint64_t>
+{
+public:
+    static constexpr int calc(Integer num, std::uint64_t b) {
+        if (num.is_neg) return 1;
+        if (num.is_small) {
+            std::uint64_t a = static_cast<std::uint64_t>(num.small);
+            return a > b ? 2 : (a < b ? 1 : 0);
+        }
+        return num.natural.cmpUi(b);
+    }
+};
+
+/**
+ * @brief Возведение целого числа в степень, заданную машинным словом.
+ */
+class PowUi : public Mapping<PowUi, Integer, Integer, std::uint64_t>
+{
+public:
+    static constexpr Integer calc(Integer num, std::uint64_t k) {
+        return Integer(Abs::execute(num).powUi(k), num.is_neg && (k & 1));
+    }
+};
+
+/**
+ * @brief Целая часть квадратного корня из неотрицательного целого числа.
+ */
+class ISqrt : public Mapping<ISqrt, Integer, Integer>
+{
+public:
+    static constexpr Integer calc(Integer num) {
+        if (num.is_neg) {
+            throw UniversalStringException("Integer: square root of a negative number");
+        }
+        if (num.is_small)
+            return Integer(static_cast<std::int64_t>(NatOper::isqrtWord(static_cast<std::uint64_t>(num.small))));
+        return Integer(num.natural.isqrt(), false);
+    }
+};
+
+/**
+ * @brief Корень k-й степени с округлением к нулю. Из отрицательного числа извлекается только корень нечетной степени.
+ */
+class IRoot : public Mapping<IRoot, Integer, Integer, std::uint64_t>
+{
+public:
+    static constexpr Integer calc(Integer num, std::uint64_t k) {
+        if (num.is_neg && k % 2 == 0) {
+            throw UniversalStringException("Integer: even root of a negative number");
+        }
+        return Integer(Abs::execute(num).iroot(k), num.is_neg);
+    }
+};
+
+/**
+ * @brief Проверка на полный квадрат, отрицательные числа квадратами не бывают.
+ */
+class IsPerfectSquare : public Mapping<IsPerfectSquare, bool, Integer>
+{
+public:
+    static constexpr bool calc(Integer num) {
+        if (num.is_neg) return false;
+        return Abs::execute(num).isPerfectSquare();
+    }
+};
+
+/**
+ * @brief Представление числа в виде r^e с наибольшим e. Для отрицательного числа допустимы только
+ * нечетные e, поэтому из показателя модуля убираются двойки: -64 = (-4)^3.
+ */
+class PerfectPower : public Mapping<PerfectPower, std::pair<Integer, std::uint64_t>, Integer>
+{
+public:
+    static constexpr std::pair<Integer, std::uint64_t> calc(Integer num) {
+        auto [root, exponent] = Abs::execute(num).perfectPower();
+        if (num.is_neg) {
+            while (exponent % 2 == 0) {
+                root = root * root;
+                exponent /= 2;
+            }
+        }
+        return {Integer(root, num.is_neg), exponent};
+    }
+};
+
+/**
+ * @brief Проверка того, что число является полной степенью r^e, e >= 2.
+ */
+class IsPerfectPower : public Mapping<IsPerfectPower, bool, Integer>
+{
+public:
+    static constexpr bool calc(Integer num) {
+        return PerfectPower::execute(num).second > 1;
+    }
+};
+
+/**
+ * @brief Биномиальный коэффициент C(n, k) для целого n: при n < 0 C(n, k) = (-1)^k C(k - n - 1, k).
+ */
+class Binomial : public Mapping<Binomial, Integer, Integer, std::uint64_t>
+{
+public:
+    static constexpr Integer calc(Integer n, std::uint64_t k) {
+        if (!n.is_neg)
+            return Integer(N::binomial(Abs::execute(n), k), false);
+        N top = Abs::execute(n).addUi(k) - N(std::uint64_t{1});
+        return Integer(N::binomial(top, k), k & 1);
+    }
+};
+
+/**
+ * @brief Убывающий факториал x (x - 1) ... (x - k + 1). При x < 0 это (-1)^k |x| (|x| + 1) ... (|x| + k - 1).
+ */
+class FallingFactorial : public Mapping<FallingFactorial, Integer, Integer, std::uint64_t>
+{
+public:
+    static constexpr Integer calc(Integer x, std::uint64_t k) {
+        if (!x.is_neg)
+            return Integer(Abs::execute(x).fallingFactorial(k), false);
+        return Integer(Abs::execute(x).risingFactorial(k), k & 1);
+    }
+};
+
+/**
+ * @brief Возрастающий факториал x (x + 1) ... (x + k - 1). При x < 0 это (-1)^k |x| (|x| - 1) ... (|x| - k + 1).
+ */
+class RisingFactorial : public Mapping<RisingFactorial, Integer, Integer, std::uint64_t>
+{
+public:
+    static constexpr Integer calc(Integer x, std::uint64_t k) {
+        if (!x.is_neg)
+            return Integer(Abs::execute(x).risingFactorial(k), false);
+        return Integer(Abs::execute(x).fallingFactorial(k), k & 1);
+    }
+};
+
 /**
  * @brief Оператор перевода целых числа в строку.
  */
@@ -229,6 +475,8 @@ class toString : public Mapping<toString, std::string, Integer>
 {
 public:
     static std::string calc(Integer num) { 
+        if (num.is_small)
+            return std::to_string(num.small);
         return (num.is_neg ? "-" : "") + num.natural.toString();
     }
 };
@@ -0,0 +1,327 @@
+#ifndef MODULAR_CRT_H
+#define MODULAR_CRT_H
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "../Natural/N.h"
+#include "../Integer/Z.h"
+#include "../Rational/Q.h"
+
+/**
+ * В данном файле инструменты модулярных методов: китайская теорема об остатках и восстановление
+ * рационального числа по его остатку.
+ *
+ * Типичная схема: задача над Q решается по нескольким простым модулям (где нет роста коэффициентов),
+ * образы склеиваются через CRT, а из остатка по произведению модулей восстанавливается дробь.
+ *
+ * @code
+ * Modular::CrtLifter lifter;
+ * for (std::uint64_t p : Primes::crtPrimes(10)) {
+ *     if (lifter.addImage(p, solveModP(p))) break;   // дробь перестала меняться
+ * }
+ * std::optional<Q> answer = lifter.reconstruct();
+ * @endcode
+ */
+
+namespace Modular {
+
+// Обратный к a по модулю m на машинных словах, 0 - если обратного нет.
+constexpr std::uint64_t invModWord(std::uint64_t a, std::uint64_t m) {
+    __int128 r0 = m, r1 = a % m, t0 = 0, t1 = 1;
+    while (r1 != 0) {
+        __int128 q = r0 / r1;
+        __int128 r2 = r0 - q * r1;
+        r0 = r1;
+        r1 = r2;
+        __int128 t2 = t0 - q * t1;
+        t0 = t1;
+        t1 = t2;
+    }
+    if (r0 != 1) return 0;
+    return static_cast<std::uint64_t>(t0 < 0 ? t0 + m : t0);
+}
+
+
+/**
+ * @brief Обратный элемент по модулю длинного числа расширенным алгоритмом Евклида. Коэффициент Безу
+ * сразу хранится по модулю m, так что знаков не возникает. std::nullopt, если gcd(a, m) != 1.
+ */
+class InvMod : public Mapping<InvMod, std::optional<Natural>, Natural, Natural>
+{
+public:
+    static constexpr std::optional<Natural> calc(Natural a, Natural m) {
+        if (m.isZero()) {
+            throw UniversalStringException("Modular: modulus can not be zero");
+        }
+        Natural r0 = m;
+        Natural r1 = NatOper::Rem::execute(a, m);
+        Natural t0(std::uint64_t{0});
+        Natural t1(std::uint64_t{1});
+        while (!r1.isZero()) {
+            auto [q, r2] = NatOper::divideWithRemainder(r0, r1);
+            r0 = std::move(r1);
+            r1 = std::move(r2);
+            Natural t2 = NatOper::subMod(t0, NatOper::mulMod(q, t1, m), m);
+            t0 = std::move(t1);
+            t1 = std::move(t2);
+        }
+        if (!r0.isOne()) return std::nullopt;
+        return NatOper::Rem::execute(t0, m);
+    }
+};
+
+
+/**
+ * @brief Образ рационального числа по модулю простого p: a * b^(-1) mod p.
+ */
+inline std::uint64_t reduce(const Q& q, std::uint64_t p) {
+    Rational value = Rat::Normalize::execute(q.get());   // p может делить лишь несокращенный знаменатель
+    std::uint64_t den = value.denominator.divmodUi(p).second;
+    std::uint64_t inv = invModWord(den, p);
+    if (inv == 0) {
+        throw UniversalStringException("Modular: the denominator is not invertible modulo p");
+    }
+    std::uint64_t num = value.numerator.divmodUi(p).second;   // остаток у Z всегда неотрицательный
+    return NatOper::mulModWord(num, inv, p);
+}
+
+
+/**
+ * @brief Восстановление дроби a/b по остатку u = a b^(-1) mod m (Ванг): расширенный алгоритм Евклида
+ * останавливается, как только остаток становится не больше num_bound. Ответ единственен, если
+ * 2 * num_bound * den_bound < m. std::nullopt, если дроби с такими границами нет.
+ */
+class RationalReconstruction : public Mapping<RationalReconstruction, std::optional<Rational>, Natural, Natural, Natural, Natural>
+{
+public:
+    static std::optional<Rational> calc(Natural u, Natural m, Natural num_bound, Natural den_bound) {
+        Z r0(m, false), r1(NatOper::Rem::execute(u, m), false);
+        Z t0 = Z::zero(), t1 = Z::identity();
+        while (Z::abs(r1) > N(num_bound)) {
+            Z q = r0 / r1;
+            Z r2 = r0 - q * r1;
+            r0 = r1;
+            r1 = r2;
+            Z t2 = t0 - q * t1;
+            t0 = t1;
+            t1 = t2;
+        }
+        N den = Z::abs(t1);
+        if (den.isZero() || den > N(den_bound) || !N::gcd(Z::abs(r1), den).isOne())
+            return std::nullopt;
+        Z num = t1.isNegative() ? -r1 : r1;
+        return Rational(num, den);
+    }
+};
+
+
+/**
+ * @brief Восстановление дроби без заданных границ по наибольшему частному (Монаган). Среди всех шагов
+ * алгоритма Евклида выбирается шаг с наибольшим неполным частным q: если q заметно больше остальных
+ * (q > threshold), то дробь этого шага почти наверняка верная. Работает при m, лишь на log2(threshold)
+ * бит большем, чем нужно для записи ответа, - вдвое меньше модулей, чем у Ванга с симметричными границами.
+ */
+class MaxQuotientReconstruction : public Mapping<MaxQuotientReconstruction, std::optional<Rational>, Natural, Natural, std::uint64_t>
+{
+public:
+    static std::optional<Rational> calc(Natural u, Natural m, std::uint64_t threshold) {
+        u = NatOper::Rem::execute(u, m);
+        if (u.isZero()) return Rational(Z::zero(), N::identity());
+
+        Z r0(m, false), r1(u, false);
+        Z t0 = Z::zero(), t1 = Z::identity();
+        N best_q = N::zero();
+        Z best_num = Z::zero(), best_den = Z::zero();
+        while (!r1.isZero()) {
+            Z q = r0 / r1;
+            if (Z::abs(q) > best_q) {
+                best_q = Z::abs(q);
+                best_num = r1;
+                best_den = t1;
+            }
+            Z r2 = r0 - q * r1;
+            r0 = r1;
+            r1 = r2;
+            Z t2 = t0 - q * t1;
+            t0 = t1;
+            t1 = t2;
+        }
+        N den = Z::abs(best_den);
+        if (best_q.cmpUi(threshold) != 2 || den.isZero() || !N::gcd(Z::abs(best_num), den).isOne())
+            return std::nullopt;
+        Z num = best_den.isNegative() ? -best_num : best_num;
+        return Rational(num, den);
+    }
+};
+
+
+/**
+ * @brief Набор попарно взаимно простых модулей с предвычислениями для CRT.
+ *
+ * Дерево произведений: листья - модули, каждый уровень - попарные произведения предыдущего, корень - M.
+ * Коэффициенты c_i = (M / m_i)^(-1) mod m_i считаются один раз: M / m_i mod m_i получается спуском
+ * остатков по дереву, без деления M на каждый модуль. Дальше склейка любого набора остатков - это
+ * подъем по тому же дереву: значение узла = левое * произведение правого + правое * произведение левого.
+ */
+class CrtBasis {
+private:
+    std::vector<std::vector<Natural>> tree;   // tree[0] - модули, tree.back() = {M}
+    std::vector<Natural> inverses;
+
+    void build() {
+        while (tree.back().size() > 1) {
+            const std::vector<Natural>& level = tree.back();
+            std::vector<Natural> next;
+            for (size_t i = 0; i + 1 < level.size(); i += 2) {
+                next.push_back(NatOper::Mul::execute(level[i], level[i + 1]));
+            }
+            if (level.size() % 2 == 1) next.push_back(level.back());
+            tree.push_back(std::move(next));
+        }
+
+        // Спуск: у каждого узла остаток произведения всех модулей вне узла по модулю произведения узла
+        std::vector<Natural> cofactors = {NatOper::Rem::execute(Natural(std::uint64_t{1}), tree.back()[0])};
+        for (size_t k = tree.size() - 1; k-- > 0;) {
+            const std::vector<Natural>& level = tree[k];
+            std::vector<Natural> next(level.size());
+            for (size_t i = 0; i < level.size(); ++i) {
+                const Natural& parent = cofactors[i / 2];
+                size_t sibling = i ^ 1;
+                next[i] = sibling < level.size() ? NatOper::mulMod(NatOper::Rem::execute(parent, level[i]),
+                                                                   NatOper::Rem::execute(level[sibling], level[i]), level[i])
+                                                 : NatOper::Rem::execute(parent, level[i]);
+            }
+            cofactors = std::move(next);
+        }
+
+        inverses.reserve(cofactors.size());
+        for (size_t i = 0; i < cofactors.size(); ++i) {
+            std::optional<Natural> inv = InvMod::execute(cofactors[i], tree[0][i]);
+            if (!inv) {
+                throw UniversalStringException("Modular: CRT moduli must be pairwise coprime");
+            }
+            inverses.push_back(std::move(*inv));
+        }
+    }
+
+public:
+    explicit CrtBasis(const std::vector<N>& moduli) {
+        if (moduli.empty()) {
+            throw UniversalStringException("Modular: CRT needs at least one modulus");
+        }
+        std::vector<Natural> leaves;
+        for (const N& m : moduli) {
+            if (m.isZero()) throw UniversalStringException("Modular: modulus can not be zero");
+            leaves.push_back(m.get());
+        }
+        tree.push_back(std::move(leaves));
+        build();
+    }
+
+    static CrtBasis fromWords(const std::vector<std::uint64_t>& moduli) {
+        std::vector<N> wrapped;
+        for (std::uint64_t m : moduli) wrapped.push_back(N(m));
+        return CrtBasis(wrapped);
+    }
+
+    size_t size() const { return tree[0].size(); }
+
+    N modulus() const { return N(tree.back()[0]); }
+
+    // Единственный x из [0, M) с x = residues[i] (mod m_i).
+    N combine(const std::vector<N>& residues) const {
+        if (residues.size() != size()) {
+            throw UniversalStringException("Modular: the number of residues does not match the number of moduli");
+        }
+        std::vector<Natural> values;
+        values.reserve(size());
+        for (size_t i = 0; i < size(); ++i) {
+            const Natural& m = tree[0][i];
+            values.push_back(NatOper::mulMod(NatOper::Rem::execute(residues[i].get(), m), inverses[i], m));
+        }
+        for (size_t k = 0; k + 1 < tree.size(); ++k) {
+            const std::vector<Natural>& level = tree[k];
+            std::vector<Natural> next;
+            for (size_t i = 0; i + 1 < level.size(); i += 2) {
+                next.push_back(NatOper::Add::execute(NatOper::Mul::execute(values[i], level[i + 1]),
+                                                     NatOper::Mul::execute(values[i + 1], level[i])));
+            }
+            if (level.size() % 2 == 1) next.push_back(values.back());
+            values = std::move(next);
+        }
+        return N(NatOper::Rem::execute(values[0], tree.back()[0]));
+    }
+
+    N combine(const std::vector<std::uint64_t>& residues) const {
+        std::vector<N> wrapped;
+        for (std::uint64_t r : residues) wrapped.push_back(N(r));
+        return combine(wrapped);
+    }
+
+    // То же, но представитель из симметричного промежутка (-M/2, M/2].
+    template<typename Residues>
+    Z combineSymmetric(const Residues& residues) const {
+        N x = combine(residues);
+        N m = modulus();
+        if (x.mulUi(2) > m) return -Z(m - x);
+        return Z(x);
+    }
+};
+
+
+/**
+ * @brief Пошаговая склейка образов по одному модулю (схема Гарнера) с ранней остановкой.
+ *
+ * Каждый новый образ сначала сверяется с дробью, восстановленной по уже накопленным модулям: если дробь
+ * ему удовлетворяет, то она, скорее всего, уже верна, и addImage возвращает true - дальше модули можно
+ * не добавлять (обычно проверку результата делает сам модулярный алгоритм).
+ */
+class CrtLifter {
+private:
+    N value = N::zero();
+    N modulus_ = N::identity();
+    std::optional<Rational> candidate;
+    std::uint64_t threshold;
+
+public:
+    explicit CrtLifter(std::uint64_t threshold = 1 << 20) : threshold(threshold) {}
+
+    bool addImage(std::uint64_t p, std::uint64_t residue) {
+        residue %= p;
+        bool confirmed = false;
+        if (candidate) {
+            std::uint64_t den = candidate->denominator.divmodUi(p).second;
+            std::uint64_t num = candidate->numerator.divmodUi(p).second;
+            confirmed = den != 0 && NatOper::mulModWord(den, residue, p) == num;
+        }
+
+        // x' = x + M * ((r - x) * M^(-1) mod p)
+        std::uint64_t m_mod = modulus_.divmodUi(p).second;
+        std::uint64_t inv = invModWord(m_mod, p);
+        if (inv == 0) {
+            throw UniversalStringException("Modular: CRT moduli must be pairwise coprime");
+        }
+        std::uint64_t x_mod = value.divmodUi(p).second;
+        std::uint64_t diff = residue >= x_mod ? residue - x_mod : residue + (p - x_mod);
+        value = value + modulus_.mulUi(NatOper::mulModWord(diff, inv, p));
+        modulus_ = modulus_.mulUi(p);
+
+        candidate = MaxQuotientReconstruction::execute(value.get(), modulus_.get(), threshold);
+        return confirmed && candidate.has_value();
+    }
+
+    const N& modulus() const { return modulus_; }
+    const N& residue() const { return value; }
+
+    std::optional<Q> reconstruct() const {
+        if (!candidate) return std::nullopt;
+        return Q(*candidate);
+    }
+};
+
+}
+
+#endif // MODULAR_CRT_H
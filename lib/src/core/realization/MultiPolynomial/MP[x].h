@@ -0,0 +1,124 @@
+#ifndef MULTI_POLYNOMIAL_STRUCTURE_H
+#define MULTI_POLYNOMIAL_STRUCTURE_H
+
+#include "../../abstract/types/mpolynom.h"
+#include "../../abstract/structures/groups.h"
+#include "../../abstract/structures/rings.h"
+#include "monomial.h"
+#include "operations.h"
+
+/**
+ * @brief Обертка полиномов от нескольких переменных с операторами.
+ * Структура: кольцо (не поле!)
+ *
+ * @code
+ * using R = MPoly<Q, MonomialOrder::GrevLex>;
+ * R x = R::variable(3, 0), y = R::variable(3, 1), z = R::variable(3, 2);
+ * R f = x * y + z * z * Q(std::int64_t{2});
+ * @endcode
+ *
+ * @tparam T Тип поля коэффициентов (должен удовлетворять Field)
+ * @tparam Order Мономиальный порядок: MonomialOrder::Lex, GrLex или GrevLex
+ */
+template<typename T, typename Order = MonomialOrder::GrevLex>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class MPoly {
+private:
+    MultiPolynomial<T, Order> value;
+
+public:
+    using AdditionOp = Multi::Add<T, Order>;
+    using MultiplicationOp = Multi::Mul<T, Order>;
+    using SetType = MultiPolynomial<T, Order>;
+
+    MPoly(MultiPolynomial<T, Order> v) : value(std::move(v)) {}
+    MPoly(std::size_t variables, std::vector<MultiTerm<T>> terms)
+        : value(Multi::FromTerms<T, Order>::execute(variables, std::move(terms))) {}
+
+    MPoly operator+(const MPoly& other) const {
+        return MPoly(Multi::Add<T, Order>::execute(value, other.value));
+    }
+
+    MPoly operator*(const MPoly& other) const {
+        return MPoly(Multi::Mul<T, Order>::execute(value, other.value));
+    }
+
+    MPoly operator-(const MPoly& other) const {
+        return MPoly(Multi::Sub<T, Order>::execute(value, other.value));
+    }
+
+    MPoly operator*(const T& scalar) const {
+        return MPoly(Multi::MulScalar<T, Order>::execute(value, scalar));
+    }
+
+    T evaluate(const std::vector<T>& point) const {
+        return Multi::Evaluate<T, Order>::execute(value, point);
+    }
+
+    // Мономы сравниваются распакованными: у равных полиномов ширина полей может отличаться.
+    bool operator==(const MPoly& other) const {
+        auto [a, b] = Multi::aligned(value, other.value);
+        if (a.coefficients.size() != b.coefficients.size() || a.monomials != b.monomials)
+            return false;
+        for (size_t i = 0; i < a.coefficients.size(); ++i) {
+            if (!(a.coefficients[i] == b.coefficients[i]))
+                return false;
+        }
+        return true;
+    }
+
+    // Полная степень, у нулевого полинома 0.
+    std::uint64_t degree() const {
+        std::uint64_t degree = 0;
+        for (size_t k = 0; k < value.size(); ++k) {
+            degree = std::max(degree, Multi::degreeOf<Order>(value.monomial(k), value.layout));
+            if constexpr (Order::graded) break;   // старший член имеет наибольшую степень
+        }
+        return degree;
+    }
+
+    // Число ненулевых членов.
+    size_t size() const {
+        return value.size();
+    }
+
+    size_t variables() const {
+        return value.layout.variables;
+    }
+
+    // Члены по убыванию в порядке Order.
+    std::vector<MultiTerm<T>> terms() const {
+        return Multi::termsOf(value);
+    }
+
+    std::string toString() const {
+        return Multi::toString<T, Order>::execute(value);
+    }
+
+    // Переменная x_(index + 1) из variables переменных.
+    static MPoly variable(std::size_t variables, std::size_t index) {
+        if (index >= variables)
+            throw UniversalStringException("MultiPolynomial: variable index out of range");
+        std::vector<std::uint64_t> exponents(variables, 0);
+        exponents[index] = 1;
+        T one = T::identity();
+        return MPoly(variables, {{exponents, one}});
+    }
+
+    static MPoly constant(std::size_t variables, const T& c) {
+        return MPoly(variables, {{std::vector<std::uint64_t>(variables, 0), c}});
+    }
+
+    static MPoly zero(std::size_t variables) {
+        return MPoly(MultiPolynomial<T, Order>(variables));
+    }
+
+    static MPoly identity(std::size_t variables) {
+        T one = T::identity();
+        return constant(variables, one);
+    }
+
+    const MultiPolynomial<T, Order>& get() const { return value; }
+};
+
+#endif //MULTI_POLYNOMIAL_STRUCTURE_H
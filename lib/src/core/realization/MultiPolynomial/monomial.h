@@ -0,0 +1,171 @@
+#ifndef MONOMIAL_MULTI_POLYNOM_H
+#define MONOMIAL_MULTI_POLYNOM_H
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "../../abstract/types/mpolynom.h"
+#include "Exceptions/UniversalStringException.h"
+
+/**
+ * В данном файле упаковка мономов и мономиальные порядки.
+ *
+ * Порядок - это политика времени компиляции: куда класть показатель каждой переменной и как сравнивать
+ * упакованные мономы. Для lex и grlex раскладка подобрана так, что мономы сравниваются как последовательности
+ * беззнаковых слов; у grevlex после полной степени поля сравниваются в обратную сторону.
+ */
+
+namespace Multi {
+
+// Поле k лежит в слове k / perWord, первые поля слова - в старших битах.
+inline unsigned shiftOf(const MonomialLayout& layout, std::size_t k) {
+    return static_cast<unsigned>((layout.perWord() - 1 - k % layout.perWord()) * layout.bits);
+}
+
+inline std::uint64_t fieldMask(const MonomialLayout& layout) {
+    return layout.bits == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << layout.bits) - 1;
+}
+
+inline std::uint64_t fieldOf(const std::uint64_t* m, const MonomialLayout& layout, std::size_t k) {
+    return (m[k / layout.perWord()] >> shiftOf(layout, k)) & fieldMask(layout);
+}
+
+// Слово монома должно быть заранее обнулено в этом поле.
+inline void setField(std::uint64_t* m, const MonomialLayout& layout, std::size_t k, std::uint64_t value) {
+    m[k / layout.perWord()] |= value << shiftOf(layout, k);
+}
+
+// Сторожевые (старшие) биты всех полей, по словам.
+inline std::vector<std::uint64_t> guardMasks(const MonomialLayout& layout) {
+    std::vector<std::uint64_t> masks(layout.words(), 0);
+    for (std::size_t k = 0; k < layout.fields(); ++k) {
+        masks[k / layout.perWord()] |= std::uint64_t{1} << (shiftOf(layout, k) + layout.bits - 1);
+    }
+    return masks;
+}
+
+// Наименьшая ширина поля, в которую значение помещается вместе со сторожевым битом.
+inline unsigned bitsFor(std::uint64_t value) {
+    for (unsigned bits : {8u, 16u, 32u, 64u}) {
+        if (value <= (std::uint64_t{1} << (bits - 1)) - 1) return bits;
+    }
+    throw UniversalStringException("MultiPolynomial: exponent does not fit into 63 bits");
+}
+
+// Сравнение слов как беззнаковых чисел с words-го слова по порядку: -1, 0, 1.
+inline int compareWords(const std::uint64_t* a, const std::uint64_t* b, std::size_t from, std::size_t words) {
+    for (std::size_t w = from; w < words; ++w) {
+        if (a[w] != b[w]) return a[w] < b[w] ? -1 : 1;
+    }
+    return 0;
+}
+
+}
+
+
+namespace MonomialOrder {
+
+/**
+ * @brief Лексикографический порядок x1 > x2 > ... > xn: поля e1, ..., en.
+ */
+struct Lex {
+    static constexpr bool graded = false;
+
+    static std::size_t fieldOfVariable(std::size_t var, std::size_t) { return var; }
+
+    static int compare(const std::uint64_t* a, const std::uint64_t* b, const MonomialLayout& layout) {
+        return Multi::compareWords(a, b, 0, layout.words());
+    }
+};
+
+/**
+ * @brief Градуированный лексикографический порядок: поля deg, e1, ..., en.
+ */
+struct GrLex {
+    static constexpr bool graded = true;
+
+    static std::size_t fieldOfVariable(std::size_t var, std::size_t) { return var + 1; }
+
+    static int compare(const std::uint64_t* a, const std::uint64_t* b, const MonomialLayout& layout) {
+        return Multi::compareWords(a, b, 0, layout.words());
+    }
+};
+
+/**
+ * @brief Градуированный обратный лексикографический порядок: поля deg, en, ..., e1. При равной степени
+ * больше тот моном, у которого меньше показатель последней различающейся переменной, поэтому после поля
+ * степени сравнение идет в обратную сторону.
+ */
+struct GrevLex {
+    static constexpr bool graded = true;
+
+    static std::size_t fieldOfVariable(std::size_t var, std::size_t variables) { return variables - var; }
+
+    static int compare(const std::uint64_t* a, const std::uint64_t* b, const MonomialLayout& layout) {
+        std::uint64_t degree_mask = Multi::fieldMask(layout) << Multi::shiftOf(layout, 0);
+        std::uint64_t da = a[0] & degree_mask, db = b[0] & degree_mask;
+        if (da != db) return da < db ? -1 : 1;
+        std::uint64_t ra = a[0] & ~degree_mask, rb = b[0] & ~degree_mask;
+        if (ra != rb) return ra < rb ? 1 : -1;
+        return -Multi::compareWords(a, b, 1, layout.words());
+    }
+};
+
+}
+
+
+namespace Multi {
+
+/**
+ * @brief Упаковка показателей в layout.words() слов (out уже нужной длины).
+ */
+template<typename Order>
+void pack(std::span<const std::uint64_t> exponents, const MonomialLayout& layout, std::uint64_t* out) {
+    std::fill(out, out + layout.words(), 0);
+    std::uint64_t degree = 0;
+    for (std::size_t var = 0; var < exponents.size(); ++var) {
+        setField(out, layout, Order::fieldOfVariable(var, layout.variables), exponents[var]);
+        degree += exponents[var];
+    }
+    if constexpr (Order::graded) setField(out, layout, 0, degree);
+}
+
+template<typename Order>
+std::vector<std::uint64_t> unpack(const std::uint64_t* m, const MonomialLayout& layout) {
+    std::vector<std::uint64_t> exponents(layout.variables);
+    for (std::size_t var = 0; var < layout.variables; ++var) {
+        exponents[var] = fieldOf(m, layout, Order::fieldOfVariable(var, layout.variables));
+    }
+    return exponents;
+}
+
+// Полная степень монома.
+template<typename Order>
+std::uint64_t degreeOf(const std::uint64_t* m, const MonomialLayout& layout) {
+    if constexpr (Order::graded) {
+        return fieldOf(m, layout, 0);
+    } else {
+        std::uint64_t degree = 0;
+        for (std::size_t k = 0; k < layout.fields(); ++k) degree += fieldOf(m, layout, k);
+        return degree;
+    }
+}
+
+/**
+ * @brief out = a + b пословно; false, если взвелся сторожевой бит (какое-то поле переполнилось).
+ */
+inline bool addMonomials(const std::uint64_t* a, const std::uint64_t* b, std::uint64_t* out,
+                         const std::vector<std::uint64_t>& guards) {
+    std::uint64_t overflow = 0;
+    for (std::size_t w = 0; w < guards.size(); ++w) {
+        out[w] = a[w] + b[w];
+        overflow |= out[w] & guards[w];
+    }
+    return overflow == 0;
+}
+
+}
+
+#endif //MONOMIAL_MULTI_POLYNOM_H
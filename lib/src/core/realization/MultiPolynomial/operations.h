@@ -0,0 +1,381 @@
+#ifndef OPERATIONS_MULTI_POLYNOM_H
+#define OPERATIONS_MULTI_POLYNOM_H
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../abstract/types/mpolynom.h"
+#include "../../abstract/transformations/operations/unary.h"
+#include "../../abstract/transformations/operations/binary.h"
+#include "../Polynomial/sparse.h"
+#include "monomial.h"
+
+/**
+ * В данном файле операции над полиномами от нескольких переменных (см. MultiPolynomial).
+ *
+ * Сложение - слияние двух отсортированных списков членов. Умножение - куча Монагана - Пирса: для каждого
+ * члена a_i в куче не больше одного кандидата a_i b_j, члены произведения выходят по убыванию и сразу
+ * складываются, так что ни промежуточных полиномов, ни сортировки нет. Мономы складываются пословно;
+ * если сторожевой бит поля взвелся, оба множителя перепаковываются в поля вдвое шире и умножение
+ * начинается заново.
+ */
+
+namespace Multi {
+
+/**
+ * @brief Перепаковка в поля другой ширины; порядок членов от ширины не зависит.
+ */
+template<typename T, typename Order>
+MultiPolynomial<T, Order> repack(const MultiPolynomial<T, Order>& poly, unsigned bits) {
+    if (poly.layout.bits == bits) return poly;
+    MultiPolynomial<T, Order> result(poly.layout.variables, bits);
+    std::size_t words = result.layout.words();
+    result.monomials.assign(poly.size() * words, 0);
+    for (std::size_t k = 0; k < poly.size(); ++k) {
+        std::vector<std::uint64_t> exponents = unpack<Order>(poly.monomial(k), poly.layout);
+        pack<Order>(exponents, result.layout, result.monomials.data() + k * words);
+    }
+    result.coefficients = poly.coefficients;
+    return result;
+}
+
+// Оба полинома в общей раскладке: число переменных обязано совпадать, ширина берется большая.
+template<typename T, typename Order>
+std::pair<MultiPolynomial<T, Order>, MultiPolynomial<T, Order>> aligned(const MultiPolynomial<T, Order>& a,
+                                                                        const MultiPolynomial<T, Order>& b) {
+    if (a.layout.variables != b.layout.variables)
+        throw UniversalStringException("MultiPolynomial: polynomials have different numbers of variables");
+    unsigned bits = std::max(a.layout.bits, b.layout.bits);
+    return {repack(a, bits), repack(b, bits)};
+}
+
+
+/**
+ * @brief Полином по членам в любом порядке: одинаковые мономы складываются, нули отбрасываются.
+ */
+template<typename T, typename Order>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class FromTerms : public Mapping<FromTerms<T, Order>, MultiPolynomial<T, Order>, std::size_t, std::vector<MultiTerm<T>>>
+{
+public:
+    static MultiPolynomial<T, Order> calc(std::size_t variables, std::vector<MultiTerm<T>> terms) {
+        std::uint64_t largest = 0;
+        for (const MultiTerm<T>& term : terms) {
+            if (term.exponents.size() != variables)
+                throw UniversalStringException("MultiPolynomial: wrong number of exponents in a term");
+            std::uint64_t degree = 0;
+            for (std::uint64_t e : term.exponents) {
+                largest = std::max(largest, e);
+                degree += e;
+                if (degree < e) throw UniversalStringException("MultiPolynomial: total degree overflow");
+            }
+            if (Order::graded) largest = std::max(largest, degree);
+        }
+
+        MultiPolynomial<T, Order> result(variables, bitsFor(largest));
+        const MonomialLayout& layout = result.layout;
+        std::size_t words = layout.words();
+        std::vector<std::uint64_t> packed(terms.size() * words);
+        for (std::size_t k = 0; k < terms.size(); ++k) pack<Order>(terms[k].exponents, layout, packed.data() + k * words);
+
+        std::vector<std::size_t> order(terms.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y) {
+            return Order::compare(packed.data() + x * words, packed.data() + y * words, layout) > 0;
+        });
+
+        T zero = T::zero();
+        for (std::size_t k : order) {
+            const std::uint64_t* m = packed.data() + k * words;
+            if (!result.isZero() && Order::compare(result.monomial(result.size() - 1), m, layout) == 0) {
+                result.coefficients.back() = result.coefficients.back() + terms[k].coefficient;
+                if (result.coefficients.back() == zero) {
+                    result.coefficients.pop_back();
+                    result.monomials.resize(result.monomials.size() - words);
+                }
+            } else if (!(terms[k].coefficient == zero)) {
+                result.monomials.insert(result.monomials.end(), m, m + words);
+                result.coefficients.push_back(std::move(terms[k].coefficient));
+            }
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Члены в распакованном виде по убыванию.
+ */
+template<typename T, typename Order>
+std::vector<MultiTerm<T>> termsOf(const MultiPolynomial<T, Order>& poly) {
+    std::vector<MultiTerm<T>> terms;
+    terms.reserve(poly.size());
+    for (std::size_t k = 0; k < poly.size(); ++k) {
+        terms.push_back({unpack<Order>(poly.monomial(k), poly.layout), poly.coefficients[k]});
+    }
+    return terms;
+}
+
+
+// Слияние двух списков членов: a + b или a - b.
+template<typename T, typename Order, bool subtract>
+MultiPolynomial<T, Order> merge(const MultiPolynomial<T, Order>& p1, const MultiPolynomial<T, Order>& p2) {
+    auto [a, b] = aligned(p1, p2);
+    const MonomialLayout& layout = a.layout;
+    std::size_t words = layout.words();
+    T zero = T::zero();
+    auto negated = [&zero](const T& c) -> T {
+        if constexpr (subtract) return zero - c;
+        else return c;
+    };
+
+    MultiPolynomial<T, Order> result(layout.variables, layout.bits);
+    result.monomials.reserve(a.monomials.size() + b.monomials.size());
+    result.coefficients.reserve(a.size() + b.size());
+    auto append = [&](const std::uint64_t* m, T coeff) {
+        result.monomials.insert(result.monomials.end(), m, m + words);
+        result.coefficients.push_back(std::move(coeff));
+    };
+
+    std::size_t i = 0, j = 0;
+    while (i < a.size() || j < b.size()) {
+        int cmp = i == a.size() ? -1 : j == b.size() ? 1 : Order::compare(a.monomial(i), b.monomial(j), layout);
+        if (cmp > 0) {
+            append(a.monomial(i), a.coefficients[i]);
+            ++i;
+        } else if (cmp < 0) {
+            append(b.monomial(j), negated(b.coefficients[j]));
+            ++j;
+        } else {
+            T sum = a.coefficients[i] + negated(b.coefficients[j]);
+            if (!(sum == zero)) append(a.monomial(i), std::move(sum));
+            ++i;
+            ++j;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Сложение полиномов от нескольких переменных
+ */
+template<typename T, typename Order>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class Add : public BinaryOperation<Add<T, Order>, MultiPolynomial<T, Order>>,
+            public Associative,
+            public Commutative,
+            public Identity,
+            public Inverse
+{
+public:
+    static MultiPolynomial<T, Order> calc(MultiPolynomial<T, Order> p1, MultiPolynomial<T, Order> p2) {
+        return merge<T, Order, false>(p1, p2);
+    }
+};
+
+/**
+ * @brief Вычитание полиномов от нескольких переменных
+ */
+template<typename T, typename Order>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class Sub : public BinaryOperation<Sub<T, Order>, MultiPolynomial<T, Order>>
+{
+public:
+    static MultiPolynomial<T, Order> calc(MultiPolynomial<T, Order> p1, MultiPolynomial<T, Order> p2) {
+        return merge<T, Order, true>(p1, p2);
+    }
+};
+
+/**
+ * @brief Умножение на скаляр
+ */
+template<typename T, typename Order>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class MulScalar : public Mapping<MulScalar<T, Order>, MultiPolynomial<T, Order>, MultiPolynomial<T, Order>, T>
+{
+public:
+    static MultiPolynomial<T, Order> calc(MultiPolynomial<T, Order> poly, T scalar) {
+        T zero = T::zero();
+        if (scalar == zero) return MultiPolynomial<T, Order>(poly.layout.variables, poly.layout.bits);
+        for (T& c : poly.coefficients) c = c * scalar;
+        return poly;
+    }
+};
+
+
+/**
+ * @brief Произведение кучей Монагана - Пирса. Кандидат члена a_i - моном a_i b_{j_i}; после его выхода
+ * в кучу идет a_i b_{j_i + 1}, а после a_i b_0 еще и a_{i+1} b_0. Мономы кандидатов лежат в общем буфере
+ * по номеру i, в куче - только номера.
+ */
+template<typename T, typename Order>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class Mul : public BinaryOperation<Mul<T, Order>, MultiPolynomial<T, Order>>,
+            public Associative,
+            public Commutative,
+            public Identity
+{
+private:
+    // std::nullopt, если переполнилось поле показателя.
+    static std::optional<MultiPolynomial<T, Order>> heapProduct(const MultiPolynomial<T, Order>& a,
+                                                                const MultiPolynomial<T, Order>& b) {
+        const MonomialLayout& layout = a.layout;
+        std::size_t words = layout.words();
+        std::vector<std::uint64_t> guards = guardMasks(layout);
+
+        std::vector<std::uint64_t> candidates(a.size() * words);
+        std::vector<std::size_t> next(a.size(), 0);
+        auto candidate = [&](std::size_t i) { return candidates.data() + i * words; };
+        auto less = [&](std::size_t x, std::size_t y) { return Order::compare(candidate(x), candidate(y), layout) < 0; };
+
+        std::vector<std::size_t> heap;
+        heap.reserve(a.size());
+        auto push = [&](std::size_t i) {
+            if (!addMonomials(a.monomial(i), b.monomial(next[i]), candidate(i), guards)) return false;
+            heap.push_back(i);
+            std::push_heap(heap.begin(), heap.end(), less);
+            return true;
+        };
+
+        T zero = T::zero();
+        MultiPolynomial<T, Order> result(layout.variables, layout.bits);
+        std::vector<std::uint64_t> current(words);
+        if (!push(0)) return std::nullopt;
+        while (!heap.empty()) {
+            std::copy(candidate(heap.front()), candidate(heap.front()) + words, current.begin());
+            T sum = zero;
+            while (!heap.empty() && Order::compare(candidate(heap.front()), current.data(), layout) == 0) {
+                std::pop_heap(heap.begin(), heap.end(), less);
+                std::size_t i = heap.back();
+                heap.pop_back();
+                sum = sum + a.coefficients[i] * b.coefficients[next[i]];
+                if (next[i] == 0 && i + 1 < a.size() && !push(i + 1)) return std::nullopt;
+                if (++next[i] < b.size() && !push(i)) return std::nullopt;
+            }
+            if (!(sum == zero)) {
+                result.monomials.insert(result.monomials.end(), current.begin(), current.end());
+                result.coefficients.push_back(std::move(sum));
+            }
+        }
+        return result;
+    }
+
+public:
+    static MultiPolynomial<T, Order> calc(MultiPolynomial<T, Order> p1, MultiPolynomial<T, Order> p2) {
+        auto [a, b] = aligned(p1, p2);
+        if (a.isZero() || b.isZero()) return MultiPolynomial<T, Order>(a.layout.variables, a.layout.bits);
+        // Куча не длиннее числа членов первого множителя.
+        if (a.size() > b.size()) std::swap(a, b);
+
+        while (true) {
+            if (std::optional<MultiPolynomial<T, Order>> product = heapProduct(a, b)) return std::move(*product);
+            if (a.layout.bits == 64)
+                throw UniversalStringException("MultiPolynomial: exponent overflow in multiplication");
+            a = repack(a, a.layout.bits * 2);
+            b = repack(b, b.layout.bits * 2);
+        }
+    }
+};
+
+
+// Выше этого показателя степени переменной возводятся отдельно, а не берутся из таблицы.
+inline constexpr std::uint64_t power_table_limit = 1024;
+
+/**
+ * @brief Значение в точке (x1, ..., xn). Степени каждой переменной до ее наибольшего показателя
+ * считаются один раз таблицей, поэтому член стоит n умножений.
+ */
+template<typename T, typename Order>
+class Evaluate : public Mapping<Evaluate<T, Order>, T, MultiPolynomial<T, Order>, std::vector<T>>
+{
+public:
+    static T calc(MultiPolynomial<T, Order> poly, std::vector<T> point) {
+        const MonomialLayout& layout = poly.layout;
+        if (point.size() != layout.variables)
+            throw UniversalStringException("MultiPolynomial: wrong number of coordinates");
+
+        std::vector<std::uint64_t> largest(layout.variables, 0);
+        for (std::size_t k = 0; k < poly.size(); ++k) {
+            for (std::size_t var = 0; var < layout.variables; ++var) {
+                largest[var] = std::max(largest[var], fieldOf(poly.monomial(k), layout, Order::fieldOfVariable(var, layout.variables)));
+            }
+        }
+
+        T one = T::identity();
+        std::vector<std::vector<T>> powers(layout.variables);
+        for (std::size_t var = 0; var < layout.variables; ++var) {
+            if (largest[var] > power_table_limit) continue;
+            powers[var].reserve(largest[var] + 1);
+            powers[var].push_back(one);
+            for (std::uint64_t e = 1; e <= largest[var]; ++e) powers[var].push_back(powers[var].back() * point[var]);
+        }
+
+        T result = T::zero();
+        for (std::size_t k = 0; k < poly.size(); ++k) {
+            T term = poly.coefficients[k];
+            for (std::size_t var = 0; var < layout.variables; ++var) {
+                std::uint64_t e = fieldOf(poly.monomial(k), layout, Order::fieldOfVariable(var, layout.variables));
+                if (e == 0) continue;
+                term = term * (powers[var].empty() ? Sparse::power(point[var], e) : powers[var][e]);
+            }
+            result = result + term;
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Строка вида 3/1*x1^2*x2 - x3 + 1/1, члены по убыванию в порядке Order.
+ */
+template<typename T, typename Order>
+class toString : public Mapping<toString<T, Order>, std::string, MultiPolynomial<T, Order>>
+{
+public:
+    static std::string calc(MultiPolynomial<T, Order> poly) {
+        T zero = T::zero();
+        T one = T::identity();
+        std::string result;
+        for (std::size_t k = 0; k < poly.size(); ++k) {
+            const T& coeff = poly.coefficients[k];
+            if (k > 0) {
+                result += coeff.isNegative() ? " - " : " + ";
+            } else if (coeff.isNegative()) {
+                result += "-";
+            }
+
+            std::string monomial;
+            std::vector<std::uint64_t> exponents = unpack<Order>(poly.monomial(k), poly.layout);
+            for (std::size_t var = 0; var < exponents.size(); ++var) {
+                if (exponents[var] == 0) continue;
+                if (!monomial.empty()) monomial += "*";
+                monomial += "x" + std::to_string(var + 1);
+                if (exponents[var] > 1) monomial += "^" + std::to_string(exponents[var]);
+            }
+
+            T abs_coeff = coeff.isNegative() ? (zero - coeff) : coeff;
+            std::string coeff_str = coeff.toString();
+            if (coeff.isNegative() && coeff_str[0] == '-') coeff_str = coeff_str.substr(1);
+            if (monomial.empty()) {
+                result += coeff_str;
+            } else if (abs_coeff == one) {
+                result += monomial;
+            } else {
+                result += coeff_str + "*" + monomial;
+            }
+        }
+        return result.empty() ? "0" : result;
+    }
+};
+
+}
+
+/**
+ * @brief Регистрация дистрибутивности: умножение дистрибутивно относительно сложения.
+ */
+template<typename T, typename Order>
+struct Distributive<Multi::Mul<T, Order>, Multi::Add<T, Order>> {};
+
+#endif //OPERATIONS_MULTI_POLYNOM_H
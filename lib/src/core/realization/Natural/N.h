@@ -5,6 +5,10 @@
 #include "../../abstract/structures/groups.h"
 #include "../../abstract/structures/rings.h"
 #include "operations.h"
+#include "primality.h"
+#include "sieve.h"
+#include "combinatorics.h"
+#include "factorization.h"
 
 
 
@@ -23,55 +27,180 @@ public:
     using MultiplicationOp = NatOper::Mul;
 	using SetType = Natural;
 
-    N(Natural v) : value(std::move(v)) {}
-    N(const std::vector<uint8_t>& nums) : value(nums) {}
+    constexpr N() = default;
+    constexpr N(Natural v) : value(std::move(v)) {}
+    constexpr N(const std::vector<uint8_t>& nums) : value(nums) {}
+    constexpr explicit N(std::uint64_t v) : value(v) {}
 
 
-    N operator+(const N& other) const {
+    constexpr N operator+(const N& other) const {
         return N(NatOper::Add::execute(value, other.value));
     }
 
-    N operator*(const N& other) const {
+    constexpr N operator*(const N& other) const {
         return N(NatOper::Mul::execute(value, other.value));
     }
 
-    N operator-(const N& other) const {
+    constexpr N operator-(const N& other) const {
         return N(NatOper::Sub::execute(value, other.value));
     }
 
-    N operator/(const N& other) const {
+    constexpr N operator/(const N& other) const {
         return N(NatOper::Div::execute(value, other.value));
     }
 
-    N operator%(const N& other) const {
+    constexpr N operator%(const N& other) const {
         return N(NatOper::Rem::execute(value, other.value));
     }
 
-    bool operator>(const N& other) const {
+    constexpr bool operator>(const N& other) const {
         return NatOper::Cmp::execute(value, other.value) == 2;
     }
 
-    bool operator<(const N& other) const {
+    constexpr bool operator<(const N& other) const {
         return NatOper::Cmp::execute(value, other.value) == 1;
     }
 
-    bool operator==(const N& other) const {
+    constexpr bool operator==(const N& other) const {
         return NatOper::Cmp::execute(value, other.value) == 0;
     }
 
-    static N gcd(const N& a, const N& b) {
+    static constexpr N gcd(const N& a, const N& b) {
         return N(NatOper::Gcd::execute(a.get(), b.get()));
     }
 
-    static N lcm(const N& a, const N& b) {
+    static constexpr N lcm(const N& a, const N& b) {
         return N(NatOper::Lcm::execute(a.get(), b.get()));
     }
 
 
-    static N zero() { return N({0}); }
-    static N identity() { return N({1}); }
+    // Операции с машинным словом.
+    constexpr N addUi(std::uint64_t b) const {
+        return N(NatOper::AddUi::execute(value, b));
+    }
+
+    constexpr N mulUi(std::uint64_t b) const {
+        return N(NatOper::MulUi::execute(value, b));
+    }
+
+    constexpr std::pair<N, std::uint64_t> divmodUi(std::uint64_t b) const {
+        auto [quotient, rem] = NatOper::DivModUi::execute(value, b);
+        return {N(std::move(quotient)), rem};
+    }
+
+    constexpr int cmpUi(std::uint64_t b) const {
+        return NatOper::CmpUi::execute(value, b);
+    }
 
-    const Natural& get() const { return value; }
+    constexpr bool fitsUInt64() const { return NatOper::FitsUi::execute(value); }
+    constexpr std::uint64_t toUInt64() const { return NatOper::ToUi::execute(value); }
+
+    constexpr std::int64_t toInt64() const {
+        std::uint64_t v = toUInt64();
+        if (v > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max())) {
+            throw UniversalStringException("Natural: the number does not fit into int64_t");
+        }
+        return static_cast<std::int64_t>(v);
+    }
+
+    constexpr std::vector<std::uint64_t> toRadix(std::uint64_t base) const {
+        return NatOper::ToRadix::execute(value, base);
+    }
+
+    static constexpr N fromRadix(const std::vector<std::uint64_t>& digits, std::uint64_t base) {
+        return N(NatOper::FromRadix::execute(digits, base));
+    }
+
+    // Степени и корни.
+    constexpr N powUi(std::uint64_t k) const {
+        return N(NatOper::PowUi::execute(value, k));
+    }
+
+    constexpr N isqrt() const {
+        return N(NatOper::ISqrt::execute(value));
+    }
+
+    constexpr N iroot(std::uint64_t k) const {
+        return N(NatOper::IRoot::execute(value, k));
+    }
+
+    constexpr bool isPerfectSquare() const { return NatOper::IsPerfectSquare::execute(value); }
+    constexpr bool isPerfectPower() const { return NatOper::IsPerfectPower::execute(value); }
+
+    // Разложение n = r^e с наибольшим e.
+    constexpr std::pair<N, std::uint64_t> perfectPower() const {
+        auto [root, exponent] = NatOper::PerfectPower::execute(value);
+        return {N(std::move(root)), exponent};
+    }
+
+    // Комбинаторика.
+    static constexpr N factorial(std::uint64_t n) {
+        return N(NatOper::Factorial::execute(n));
+    }
+
+    static constexpr N binomial(const N& n, std::uint64_t k) {
+        return N(NatOper::Binomial::execute(n.get(), k));
+    }
+
+    static constexpr N multinomial(const std::vector<std::uint64_t>& ks) {
+        return N(NatOper::Multinomial::execute(ks));
+    }
+
+    static constexpr N product(const std::vector<N>& values) {
+        std::vector<Natural> raw;
+        raw.reserve(values.size());
+        for (const N& v : values) raw.push_back(v.get());
+        return N(NatOper::Product::execute(std::move(raw)));
+    }
+
+    constexpr N risingFactorial(std::uint64_t k) const {
+        return N(NatOper::RisingFactorial::execute(value, k));
+    }
+
+    constexpr N fallingFactorial(std::uint64_t k) const {
+        return N(NatOper::FallingFactorial::execute(value, k));
+    }
+
+    constexpr N sqr() const {
+        return N(NatOper::Sqr::execute(value));
+    }
+
+    // Теория чисел.
+    constexpr N powMod(const N& e, const N& m) const {
+        return N(NatOper::PowMod::execute(value, e.get(), m.get()));
+    }
+
+    // Для чисел до 2^64 ответ точный, для длинных - тест BPSW.
+    constexpr bool isProbablePrime() const { return NatOper::IsProbablePrime::execute(value); }
+
+    // Разложение на простые множители: пары (простое, показатель) по возрастанию.
+    std::vector<std::pair<N, std::uint64_t>> factor(const NatOper::FactorOptions& options = {}) const {
+        std::vector<std::pair<N, std::uint64_t>> result;
+        for (auto& [p, e] : NatOper::Factor::execute(value, options)) {
+            result.push_back({N(std::move(p)), e});
+        }
+        return result;
+    }
+
+    N eulerPhi() const {
+        return N(NatOper::EulerPhi::execute(value));
+    }
+
+    constexpr bool isZero() const { return value.isZero(); }
+    constexpr bool isOne() const { return value.isOne(); }
+
+    // Нейтральные элементы строятся один раз и дальше только копируются.
+    static const N& zero() {
+        static const N instance(std::uint64_t{0});
+        return instance;
+    }
+
+    static const N& identity() {
+        static const N instance(std::uint64_t{1});
+        return instance;
+    }
+
+    constexpr const Natural& get() const { return value; }
 
     std::string toString() const {
         return NatOper::toString::execute(value);
@@ -79,6 +208,15 @@ public:
 };
 
 
+/**
+ * @brief Литерал натурального числа: 123_N. Разряды берутся прямо из записи литерала,
+ * поэтому длина числа не ограничена машинным словом.
+ */
+constexpr N operator""_N(const char* literal) {
+    return N(NatOper::fromString::execute(literal));
+}
+
+
 
 /**
  * Пример использования в полиноме:
@@ -0,0 +1,230 @@
+#ifndef COMBINATORICS_NATURAL_H
+#define COMBINATORICS_NATURAL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "operations.h"
+#include "sieve.h"
+
+/**
+ * В данном файле комбинаторика натуральных чисел. Длинные произведения собираются сбалансированным деревом:
+ * множители сначала перемножаются в машинном слове, пока произведение помещается, потом попарно, так что на
+ * каждом уровне перемножаются числа близкой длины. Последовательное умножение "слева направо" дает
+ * квадратичный рост стоимости, потому что каждый раз длинное число умножается на короткое.
+ */
+
+namespace NatOper {
+
+// Произведение values[lo, hi) сбалансированным деревом.
+constexpr Natural productTree(const std::vector<Natural>& values, size_t lo, size_t hi) {
+    if (hi - lo == 1) return values[lo];
+    if (hi - lo == 2) return Mul::execute(values[lo], values[lo + 1]);
+    size_t mid = lo + (hi - lo) / 2;
+    return Mul::execute(productTree(values, lo, mid), productTree(values, mid, hi));
+}
+
+// Произведение машинных слов: соседние слова склеиваются, пока помещаются в uint64_t, затем дерево.
+constexpr Natural productOfWords(const std::vector<std::uint64_t>& words) {
+    std::vector<Natural> chunks;
+    std::uint64_t acc = 1;
+    for (std::uint64_t w : words) {
+        if (w == 0) return Natural(std::vector<uint8_t>{0});
+        std::uint64_t next;
+        if (__builtin_mul_overflow(acc, w, &next)) {
+            chunks.push_back(Natural(acc));
+            acc = w;
+        } else {
+            acc = next;
+        }
+    }
+    chunks.push_back(Natural(acc));
+    return productTree(chunks, 0, chunks.size());
+}
+
+// Простые не больше n: на этапе компиляции - обычное решето, иначе общая таблица простых.
+constexpr std::vector<std::uint64_t> primeList(std::uint64_t n) {
+    if (std::is_constant_evaluated())
+        return Primes::primesUpTo(n);
+    return Primes::PrimeTable::instance().upTo(n);
+}
+
+// Показатель простого p в n! (формула Лежандра).
+constexpr std::uint64_t legendre(std::uint64_t n, std::uint64_t p) {
+    std::uint64_t e = 0;
+    while (n >= p) {
+        n /= p;
+        e += n;
+    }
+    return e;
+}
+
+// Число с простыми множителями p из primes в степенях exponentOf(p).
+template<typename ExponentOf>
+constexpr Natural productOfPrimePowers(const std::vector<std::uint64_t>& primes, ExponentOf exponentOf) {
+    std::vector<std::uint64_t> factors;
+    for (std::uint64_t p : primes) {
+        std::uint64_t e = exponentOf(p);
+        for (std::uint64_t i = 0; i < e; ++i) {
+            factors.push_back(p);
+        }
+    }
+    return productOfWords(factors);
+}
+
+
+/**
+ * @brief Произведение набора натуральных чисел сбалансированным деревом.
+ */
+class Product : public Mapping<Product, Natural, std::vector<Natural>>
+{
+public:
+    static constexpr Natural calc(std::vector<Natural> values) {
+        if (values.empty()) return Natural(std::uint64_t{1});
+        return productTree(values, 0, values.size());
+    }
+};
+
+
+/**
+ * @brief Факториал по алгоритму "простого качания" (prime swing): n! = ((n/2)!)^2 * swing(n),
+ * где swing(n) = n! / ((n/2)!)^2 собирается из простых p <= n в степенях sum_i (floor(n / p^i) mod 2).
+ * Квадрат считается через Sqr, простые берутся из общей таблицы один раз на всю рекурсию.
+ */
+class Factorial : public Mapping<Factorial, Natural, std::uint64_t>
+{
+private:
+    static constexpr Natural swing(std::uint64_t n, const std::vector<std::uint64_t>& primes) {
+        std::vector<std::uint64_t> factors;
+        for (std::uint64_t p : primes) {
+            if (p > n) break;
+            std::uint64_t q = n;
+            std::uint64_t power = 1;   // p^e <= n, так что в слово помещается
+            while (q >= p) {
+                q /= p;
+                if (q & 1) power *= p;
+            }
+            if (power > 1) factors.push_back(power);
+        }
+        return productOfWords(factors);
+    }
+
+    static constexpr Natural recursive(std::uint64_t n, const std::vector<std::uint64_t>& primes) {
+        if (n <= 20) {
+            std::uint64_t value = 1;
+            for (std::uint64_t i = 2; i <= n; ++i) value *= i;
+            return Natural(value);
+        }
+        return Mul::execute(Sqr::execute(recursive(n / 2, primes)), swing(n, primes));
+    }
+
+public:
+    static constexpr Natural calc(std::uint64_t n) {
+        return recursive(n, n <= 20 ? std::vector<std::uint64_t>{} : primeList(n));
+    }
+};
+
+
+/**
+ * @brief Убывающий факториал x (x - 1) ... (x - k + 1).
+ */
+class FallingFactorial : public Mapping<FallingFactorial, Natural, Natural, std::uint64_t>
+{
+public:
+    static constexpr Natural calc(Natural x, std::uint64_t k) {
+        if (k == 0) return Natural(std::uint64_t{1});
+        if (CmpUi::execute(x, k) == 1) return Natural(std::vector<uint8_t>{0});
+        if (FitsUi::execute(x)) {
+            std::uint64_t top = ToUi::execute(x);
+            std::vector<std::uint64_t> words(k);
+            for (std::uint64_t i = 0; i < k; ++i) words[i] = top - i;
+            return productOfWords(words);
+        }
+        std::vector<Natural> values;
+        values.reserve(k);
+        for (std::uint64_t i = 0; i < k; ++i) values.push_back(Sub::execute(x, Natural(i)));
+        return productTree(values, 0, values.size());
+    }
+};
+
+
+/**
+ * @brief Возрастающий факториал x (x + 1) ... (x + k - 1).
+ */
+class RisingFactorial : public Mapping<RisingFactorial, Natural, Natural, std::uint64_t>
+{
+public:
+    static constexpr Natural calc(Natural x, std::uint64_t k) {
+        if (k == 0) return Natural(std::uint64_t{1});
+        return FallingFactorial::execute(AddUi::execute(x, k - 1), k);
+    }
+};
+
+
+// Выше этой границы простые не просеиваются, коэффициенты считаются делением произведений.
+inline constexpr std::uint64_t prime_power_limit = std::uint64_t{1} << 24;
+
+
+/**
+ * @brief Биномиальный коэффициент C(n, k). Если n не слишком велико для решета, коэффициент собирается сразу
+ * из простых множителей: показатель p равен v_p(n!) - v_p(k!) - v_p((n-k)!). Иначе считается
+ * n (n-1) ... (n-k+1) / k!, при n в машинном слове - для меньшего из k и n - k.
+ */
+class Binomial : public Mapping<Binomial, Natural, Natural, std::uint64_t>
+{
+public:
+    static constexpr Natural calc(Natural n, std::uint64_t k) {
+        if (CmpUi::execute(n, k) == 1) return Natural(std::vector<uint8_t>{0});
+        if (FitsUi::execute(n)) {
+            std::uint64_t top = ToUi::execute(n);
+            k = std::min(k, top - k);
+            if (k == 0) return Natural(std::uint64_t{1});
+            if (top <= prime_power_limit) {
+                return productOfPrimePowers(primeList(top), [&](std::uint64_t p) {
+                    return legendre(top, p) - legendre(k, p) - legendre(top - k, p);
+                });
+            }
+        }
+        return Div::execute(FallingFactorial::execute(n, k), Factorial::execute(k));
+    }
+};
+
+
+/**
+ * @brief Мультиномиальный коэффициент (k_1 + ... + k_m)! / (k_1! ... k_m!), собирается из простых множителей.
+ * Если сумма больше prime_power_limit, наибольшее k_j сокращается сразу: коэффициент равен
+ * total (total-1) ... (k_j+1) / prod_{i != j} k_i!.
+ */
+class Multinomial : public Mapping<Multinomial, Natural, std::vector<std::uint64_t>>
+{
+public:
+    static constexpr Natural calc(std::vector<std::uint64_t> ks) {
+        std::uint64_t total = 0;
+        for (std::uint64_t k : ks) {
+            if (__builtin_add_overflow(total, k, &total)) {
+                throw UniversalStringException("Natural: multinomial total does not fit into uint64_t");
+            }
+        }
+        if (total > prime_power_limit) {
+            auto largest = std::max_element(ks.begin(), ks.end());
+            std::vector<Natural> factorials;
+            for (auto it = ks.begin(); it != ks.end(); ++it) {
+                if (it != largest && *it > 1) factorials.push_back(Factorial::execute(*it));
+            }
+            Natural numerator = FallingFactorial::execute(Natural(total), total - *largest);
+            if (factorials.empty()) return numerator;
+            return Div::execute(numerator, Product::execute(factorials));
+        }
+        return productOfPrimePowers(primeList(total), [&](std::uint64_t p) {
+            std::uint64_t e = legendre(total, p);
+            for (std::uint64_t k : ks) e -= legendre(k, p);
+            return e;
+        });
+    }
+};
+
+}
+
+#endif // COMBINATORICS_NATURAL_H
@@ -0,0 +1,439 @@
+#ifndef FACTORIZATION_NATURAL_H
+#define FACTORIZATION_NATURAL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "operations.h"
+#include "primality.h"
+#include "sieve.h"
+
+/**
+ * В данном файле разложение натуральных чисел на простые множители.
+ *
+ * Стратегия ступенчатая, каждая следующая ступень дороже и ищет множители крупнее:
+ *  1. пробное деление на простые из общей таблицы (до FactorOptions::trial_bound);
+ *  2. числа в пределах машинного слова добиваются ро-методом Полларда-Брента на словах;
+ *  3. у длинных составных сначала проверяется, не степень ли это, затем ро-метод с ограниченным
+ *     числом шагов (gcd считается один раз на пачку шагов);
+ *  4. метод эллиптических кривых Ленстры: кривые Монтгомери, первая стадия лестницей, вторая - шагами
+ *     младенца и великана. Кривые независимы и раздаются потокам.
+ *
+ * Разложение можно прервать флагом FactorOptions::cancel, тогда бросается исключение.
+ */
+
+namespace NatOper {
+
+/**
+ * @brief Настройки разложения.
+ */
+struct FactorOptions {
+    const std::atomic<bool>* cancel = nullptr;        // выставленный флаг прерывает разложение
+    unsigned threads = 0;                             // потоки для кривых ECM, 0 - по числу ядер
+    std::uint64_t trial_bound = 10000;                // граница пробного деления
+    std::uint64_t rho_iterations = std::uint64_t{1} << 14;  // бюджет ро-метода для длинных чисел
+};
+
+// Разложение в виде пар (простое, показатель) по возрастанию простых.
+using Factorization = std::vector<std::pair<Natural, std::uint64_t>>;
+
+/**
+ * @brief Пара флагов остановки: внешний (отмена пользователем) и внутренний (другая кривая уже нашла делитель).
+ */
+struct StopToken {
+    const std::atomic<bool>* first = nullptr;
+    const std::atomic<bool>* second = nullptr;
+
+    bool stopRequested() const {
+        return (first && first->load(std::memory_order_relaxed)) ||
+               (second && second->load(std::memory_order_relaxed));
+    }
+};
+
+inline void throwIfCancelled(const FactorOptions& options) {
+    if (options.cancel && options.cancel->load(std::memory_order_relaxed)) {
+        throw UniversalStringException("Natural: factorization cancelled");
+    }
+}
+
+constexpr Natural absDiff(const Natural& a, const Natural& b) {
+    return Cmp::execute(a, b) == 1 ? Sub::execute(b, a) : Sub::execute(a, b);
+}
+
+
+// Делитель 1 < d < n нечетного составного n ро-методом Полларда-Брента на машинных словах.
+constexpr std::uint64_t rhoWord(std::uint64_t n) {
+    constexpr std::uint64_t batch = 128;
+    for (std::uint64_t c = 1;; ++c) {
+        auto f = [&](std::uint64_t v) { return (mulModWord(v, v, n) + c) % n; };
+        std::uint64_t x = 0, y = 2, ys = 2, q = 1, g = 1;
+        for (std::uint64_t r = 1; g == 1; r *= 2) {
+            x = y;
+            for (std::uint64_t i = 0; i < r; ++i) y = f(y);
+            for (std::uint64_t k = 0; k < r && g == 1; k += batch) {
+                ys = y;
+                for (std::uint64_t i = 0; i < std::min(batch, r - k); ++i) {
+                    y = f(y);
+                    q = mulModWord(q, x > y ? x - y : y - x, n);
+                }
+                g = std::gcd(q, n);
+            }
+        }
+        // Пачка проскочила делитель - повторяем ее по одному шагу
+        if (g == n) {
+            do {
+                ys = f(ys);
+                g = std::gcd(x > ys ? x - ys : ys - x, n);
+            } while (g == 1);
+        }
+        if (g != n) return g;
+    }
+}
+
+// Разложение машинного слова, простые с кратностями дописываются в out (без сортировки).
+constexpr void factorWord(std::uint64_t n, std::uint64_t multiplicity,
+                          std::vector<std::pair<std::uint64_t, std::uint64_t>>& out) {
+    for (std::uint64_t p : small_primes) {
+        std::uint64_t e = 0;
+        while (n % p == 0) {
+            n /= p;
+            ++e;
+        }
+        if (e > 0) out.push_back({p, e * multiplicity});
+    }
+    if (n == 1) return;
+    if (isPrimeWord(n)) {
+        out.push_back({n, multiplicity});
+        return;
+    }
+    std::uint64_t root = irootWord(n, 2);
+    if (root * root == n) {
+        factorWord(root, 2 * multiplicity, out);
+        return;
+    }
+    std::uint64_t d = rhoWord(n);
+    factorWord(d, multiplicity, out);
+    factorWord(n / d, multiplicity, out);
+}
+
+
+/**
+ * @brief Ро-метод Полларда-Брента для длинного нечетного составного n, f(x) = x^2 + c.
+ * Разности копятся в произведении по модулю n, gcd считается раз в пачку. Возвращает делитель или
+ * std::nullopt, если за iterations шагов он не нашелся.
+ */
+class PollardRho : public Mapping<PollardRho, std::optional<Natural>, Natural, std::uint64_t, StopToken>
+{
+public:
+    static std::optional<Natural> calc(Natural n, std::uint64_t iterations, StopToken stop) {
+        constexpr std::uint64_t batch = 64;
+        for (std::uint64_t c = 1; c <= 3; ++c) {
+            Natural shift(c);
+            auto f = [&](const Natural& v) { return addMod(sqrMod(v, n), shift, n); };
+            Natural x, y(std::uint64_t{2}), ys = y, q(std::uint64_t{1}), g(std::uint64_t{1});
+            std::uint64_t steps = 0;
+            for (std::uint64_t r = 1; g.isOne() && steps < iterations; r *= 2) {
+                x = y;
+                for (std::uint64_t i = 0; i < r; ++i) y = f(y);
+                for (std::uint64_t k = 0; k < r && g.isOne(); k += batch) {
+                    if (stop.stopRequested()) return std::nullopt;
+                    ys = y;
+                    for (std::uint64_t i = 0; i < std::min(batch, r - k); ++i) {
+                        y = f(y);
+                        q = mulMod(q, absDiff(x, y), n);
+                    }
+                    g = Gcd::execute(q, n);
+                    steps += batch;
+                }
+            }
+            if (Cmp::execute(g, n) == 0) {
+                do {
+                    ys = f(ys);
+                    g = Gcd::execute(absDiff(x, ys), n);
+                } while (g.isOne());
+            }
+            if (!g.isOne() && Cmp::execute(g, n) != 0) return g;
+        }
+        return std::nullopt;
+    }
+};
+
+
+/**
+ * @brief Одна кривая метода эллиптических кривых Ленстры.
+ *
+ * Кривая Монтгомери By^2 = x^3 + Ax^2 + x в параметризации Суямы по sigma, точки хранятся в проективных
+ * координатах (X : Z) без y. Коэффициент (A + 2) / 4 тоже хранится дробью, так что обращений по модулю нет.
+ * Первая стадия умножает точку на все степени простых до B1, вторая ловит один простой q из (B1, 100 B1]
+ * шагами младенца и великана по D = 210: q = mD +- j, и X_{mD} Z_j - X_j Z_{mD} = 0 (mod p) ровно тогда,
+ * когда [mD]Q = +-[j]Q на кривой по модулю p.
+ */
+class Ecm : public Mapping<Ecm, std::optional<Natural>, Natural, std::uint64_t, std::uint64_t, StopToken>
+{
+private:
+    struct Point {
+        Natural x;
+        Natural z;
+    };
+
+    struct Curve {
+        Natural n;
+        Natural a24_num;   // (A + 2) / 4 = a24_num / a24_den
+        Natural a24_den;
+    };
+
+    static Point dbl(const Point& p, const Curve& c) {
+        const Natural& n = c.n;
+        Natural t1 = sqrMod(addMod(p.x, p.z, n), n);
+        Natural t2 = sqrMod(subMod(p.x, p.z, n), n);
+        Natural t3 = subMod(t1, t2, n);
+        Natural x = mulMod(mulMod(t1, t2, n), c.a24_den, n);
+        Natural z = mulMod(t3, addMod(mulMod(c.a24_den, t2, n), mulMod(c.a24_num, t3, n), n), n);
+        return {x, z};
+    }
+
+    // p + q по известной разности diff = p - q.
+    static Point add(const Point& p, const Point& q, const Point& diff, const Natural& n) {
+        Natural u = mulMod(subMod(p.x, p.z, n), addMod(q.x, q.z, n), n);
+        Natural v = mulMod(addMod(p.x, p.z, n), subMod(q.x, q.z, n), n);
+        Natural x = mulMod(diff.z, sqrMod(addMod(u, v, n), n), n);
+        Natural z = mulMod(diff.x, sqrMod(subMod(u, v, n), n), n);
+        return {x, z};
+    }
+
+    // [k]P лестницей Монтгомери, k >= 1.
+    static Point ladder(std::uint64_t k, const Point& p, const Curve& c) {
+        if (k == 1) return p;
+        Point r0 = p;
+        Point r1 = dbl(p, c);
+        for (int bit = 62 - __builtin_clzll(k); bit >= 0; --bit) {
+            if ((k >> bit) & 1) {
+                r0 = add(r1, r0, p, c.n);
+                r1 = dbl(r1, c);
+            } else {
+                r1 = add(r0, r1, p, c.n);
+                r0 = dbl(r0, c);
+            }
+        }
+        return r0;
+    }
+
+    // Делитель из gcd(value, n), если он нетривиален.
+    static std::optional<Natural> splitBy(const Natural& value, const Natural& n) {
+        if (value.isZero()) return std::nullopt;
+        Natural g = Gcd::execute(value, n);
+        if (g.isOne() || Cmp::execute(g, n) == 0) return std::nullopt;
+        return g;
+    }
+
+public:
+    static std::optional<Natural> calc(Natural n, std::uint64_t b1, std::uint64_t sigma, StopToken stop) {
+        // Параметризация Суямы: u = sigma^2 - 5, v = 4 sigma, точка (u^3 : v^3),
+        // (A + 2) / 4 = (v - u)^3 (3u + v) / (16 u^3 v)
+        Natural s = Rem::execute(Natural(sigma), n);
+        Natural u = subMod(sqrMod(s, n), Rem::execute(Natural(std::uint64_t{5}), n), n);
+        Natural v = Rem::execute(MulUi::execute(s, 4), n);
+        Natural u3 = mulMod(sqrMod(u, n), u, n);
+        Natural v_minus_u = subMod(v, u, n);
+        Natural num = mulMod(mulMod(sqrMod(v_minus_u, n), v_minus_u, n),
+                             addMod(Rem::execute(MulUi::execute(u, 3), n), v, n), n);
+        Natural den = Rem::execute(MulUi::execute(mulMod(u3, v, n), 16), n);
+        if (auto g = splitBy(den, n)) return g;
+        if (den.isZero()) return std::nullopt;
+
+        Curve curve{n, num, den};
+        Point q{u3, mulMod(sqrMod(v, n), v, n)};
+
+        // Стадия 1: Q = [k]Q, k = произведение p^e <= B1
+        for (std::uint64_t p : Primes::PrimeTable::instance().upTo(b1)) {
+            if (stop.stopRequested()) return std::nullopt;
+            std::uint64_t power = p;
+            while (power <= b1 / p) power *= p;
+            q = ladder(power, q, curve);
+        }
+        if (auto g = splitBy(q.z, n)) return g;
+        if (q.z.isZero()) return std::nullopt;   // порядок точки гладкий по всем делителям сразу
+
+        // Стадия 2: шаги младенца [j]Q для нечетных j < D/2, взаимно простых с D
+        constexpr std::uint64_t D = 210;
+        std::uint64_t b2 = 100 * b1;
+        std::vector<Point> baby(D / 2);
+        Point q2 = dbl(q, curve);
+        baby[1] = q;
+        baby[3] = add(q2, q, q, n);
+        for (std::uint64_t j = 5; j < D / 2; j += 2) baby[j] = add(baby[j - 2], q2, baby[j - 4], n);
+
+        // Шаги великана R_m = [mD]Q
+        Point giant = ladder(D, q, curve);
+        std::uint64_t m = std::max<std::uint64_t>(1, b1 / D);
+        Point prev = ladder(m * D, q, curve);
+        Point cur = ladder((m + 1) * D, q, curve);
+        Natural acc(std::uint64_t{1});
+        for (++m; m * D <= b2 + D; ++m) {
+            if (stop.stopRequested()) return std::nullopt;
+            for (std::uint64_t j = 1; j < D / 2; j += 2) {
+                if (std::gcd(j, D) != 1) continue;
+                if (!isPrimeWord(m * D + j) && !isPrimeWord(m * D - j)) continue;
+                acc = mulMod(acc, subMod(mulMod(cur.x, baby[j].z, n), mulMod(baby[j].x, cur.z, n), n), n);
+            }
+            Point next = add(cur, giant, prev, n);
+            prev = std::move(cur);
+            cur = std::move(next);
+        }
+        return splitBy(acc, n);
+    }
+};
+
+
+// Несколько кривых ECM параллельно: потоки берут номера кривых из общего счетчика, первый найденный делитель
+// останавливает остальных.
+inline std::optional<Natural> ecmCurves(const Natural& n, std::uint64_t b1, std::uint64_t curves,
+                                        std::uint64_t first_sigma, const FactorOptions& options) {
+    unsigned threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned>(std::min<std::uint64_t>(threads, curves));
+
+    std::atomic<bool> found{false};
+    std::atomic<std::uint64_t> next{0};
+    std::optional<Natural> result;
+    std::mutex result_lock;
+    StopToken stop{options.cancel, &found};
+
+    auto worker = [&] {
+        while (!stop.stopRequested()) {
+            std::uint64_t index = next.fetch_add(1);
+            if (index >= curves) return;
+            std::optional<Natural> d = Ecm::execute(n, b1, first_sigma + index, stop);
+            if (d) {
+                std::lock_guard<std::mutex> guard(result_lock);
+                if (!result) result = std::move(d);
+                found = true;
+            }
+        }
+    };
+
+    if (threads <= 1) {
+        worker();
+    } else {
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t) pool.emplace_back(worker);
+        for (std::thread& th : pool) th.join();
+    }
+    throwIfCancelled(options);
+    return result;
+}
+
+
+/**
+ * @brief Разложение натурального числа на простые множители. Для 0 разложение не определено, для 1 оно пустое.
+ */
+class Factor : public Mapping<Factor, Factorization, Natural, FactorOptions>
+{
+private:
+    // Уровни ECM: граница первой стадии и число кривых.
+    static constexpr std::pair<std::uint64_t, std::uint64_t> ecm_levels[] = {
+        {2000, 25}, {11000, 90}, {50000, 300}, {250000, 700}};
+
+    static Natural findDivisor(const Natural& c, const FactorOptions& options) {
+        StopToken stop{options.cancel, nullptr};
+        if (std::optional<Natural> d = PollardRho::execute(c, options.rho_iterations, stop)) return *d;
+        throwIfCancelled(options);
+
+        std::uint64_t sigma = 6;
+        for (auto [b1, curves] : ecm_levels) {
+            if (std::optional<Natural> d = ecmCurves(c, b1, curves, sigma, options)) return *d;
+            sigma += curves;
+        }
+        throw UniversalStringException("Natural: failed to factor " + toString::execute(c));
+    }
+
+public:
+    static Factorization calc(Natural n, FactorOptions options) {
+        if (n.isZero()) {
+            throw UniversalStringException("Natural: factorization of zero is not defined");
+        }
+        std::vector<std::pair<Natural, std::uint64_t>> primes;
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> word_primes;
+
+        // Пробное деление
+        if (!FitsUi::execute(n)) {
+            for (std::uint64_t p : Primes::PrimeTable::instance().upTo(options.trial_bound)) {
+                std::uint64_t e = 0;
+                while (true) {
+                    auto [quotient, rem] = DivModUi::execute(n, p);
+                    if (rem != 0) break;
+                    n = std::move(quotient);
+                    ++e;
+                }
+                if (e > 0) word_primes.push_back({p, e});
+                if (FitsUi::execute(n)) break;
+            }
+        }
+
+        std::vector<std::pair<Natural, std::uint64_t>> work;
+        if (!n.isOne()) work.push_back({n, 1});
+        while (!work.empty()) {
+            throwIfCancelled(options);
+            auto [c, multiplicity] = std::move(work.back());
+            work.pop_back();
+
+            if (FitsUi::execute(c)) {
+                factorWord(ToUi::execute(c), multiplicity, word_primes);
+                continue;
+            }
+            if (IsProbablePrime::execute(c)) {
+                primes.push_back({c, multiplicity});
+                continue;
+            }
+            auto [root, exponent] = PerfectPower::execute(c);
+            if (exponent > 1) {
+                work.push_back({root, multiplicity * exponent});
+                continue;
+            }
+            Natural d = findDivisor(c, options);
+            work.push_back({Div::execute(c, d), multiplicity});
+            work.push_back({d, multiplicity});
+        }
+
+        for (auto [p, e] : word_primes) primes.push_back({Natural(p), e});
+        std::sort(primes.begin(), primes.end(), [](const auto& a, const auto& b) {
+            return Cmp::execute(a.first, b.first) == 1;
+        });
+
+        Factorization result;
+        for (auto& [p, e] : primes) {
+            if (!result.empty() && Cmp::execute(result.back().first, p) == 0)
+                result.back().second += e;
+            else
+                result.push_back({std::move(p), e});
+        }
+        return result;
+    }
+};
+
+
+/**
+ * @brief Функция Эйлера: phi(n) = prod p^(e-1) (p - 1).
+ */
+class EulerPhi : public Mapping<EulerPhi, Natural, Natural>
+{
+public:
+    static Natural calc(Natural n) {
+        Natural result(std::uint64_t{1});
+        for (auto& [p, e] : Factor::execute(n, FactorOptions{})) {
+            Natural p_minus_one = Sub::execute(p, Natural(std::uint64_t{1}));
+            result = Mul::execute(result, Mul::execute(PowUi::execute(p, e - 1), p_minus_one));
+        }
+        return result;
+    }
+};
+
+}
+
+#endif // FACTORIZATION_NATURAL_H
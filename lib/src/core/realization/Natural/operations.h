@@ -2,7 +2,12 @@
 #define OPERATIONS_NATURAL_H
 
 #include <string>
+#include <string_view>
 #include <iostream>
+#include <cstdint>
+#include <utility>
+#include <limits>
+#include <algorithm>
 
 #include "../../abstract/types/natural.h"
 #include "../../abstract/transformations/operations/binary.h"
@@ -27,7 +32,7 @@ class Add : public BinaryOperation<Add, Natural>,
             public Identity
 {
 public:
-    static Natural calc(Natural num1, Natural num2) { 
+    static constexpr Natural calc(Natural num1, Natural num2) { 
         size_t n = num1.nums.size();
         size_t m = num2.nums.size();
         size_t maxlen = std::max(n, m);
@@ -56,9 +61,8 @@ class Mul : public BinaryOperation<Mul, Natural>,
             public Identity
 {
 public:
-    static Natural calc(Natural num1, Natural num2) { 
-        if ((num1.nums.size() == 1 && num1.nums[0] == 0) ||
-            (num2.nums.size() == 1 && num2.nums[0] == 0)) {
+    static constexpr Natural calc(Natural num1, Natural num2) { 
+        if (num1.isZero() || num2.isZero()) {
             return Natural(std::vector<uint8_t>{0});
         }
         std::vector<uint8_t> res(num1.nums.size() + num2.nums.size(), 0);
@@ -80,6 +84,38 @@ public:
 };
 
 
+/**
+ * @brief Возведение в квадрат. Каждое перекрестное произведение a_i * a_j считается один раз (вдвое
+ * меньше умножений, чем в Mul), суммы копятся по столбцам в 64-битных словах, перенос делается один раз в конце.
+ */
+class Sqr : public Mapping<Sqr, Natural, Natural>
+{
+public:
+    static constexpr Natural calc(Natural num) {
+        if (num.isZero()) {
+            return Natural(std::vector<uint8_t>{0});
+        }
+        size_t n = num.nums.size();
+        std::vector<std::uint64_t> columns(2 * n, 0);
+        for (size_t i = 0; i < n; ++i) {
+            std::uint64_t a = num.nums[i];
+            if (a == 0) continue;
+            columns[2 * i] += a * a;
+            for (size_t j = i + 1; j < n; ++j) {
+                columns[i + j] += 2 * a * num.nums[j];
+            }
+        }
+        std::vector<uint8_t> res(2 * n, 0);
+        std::uint64_t carry = 0;
+        for (size_t i = 0; i < 2 * n; ++i) {
+            std::uint64_t cur = columns[i] + carry;
+            res[i] = static_cast<uint8_t>(cur % 10);
+            carry = cur / 10;
+        }
+        return Natural(res);
+    }
+};
+
 
 /**
  * @brief Оператор сравнения элементов в натуральных числах.
@@ -87,7 +123,7 @@ public:
 class Cmp : public Mapping<Cmp, int, Natural, Natural>
 {
 public:
-    static int calc(Natural num1, Natural num2) { 
+    static constexpr int calc(Natural num1, Natural num2) { 
         if (num1.nums.size() > num2.nums.size()) return 2;
         if (num1.nums.size() < num2.nums.size()) return 1;
         for (size_t i = num1.nums.size(); i-- > 0;) {
@@ -102,9 +138,9 @@ public:
 
 
 // Вспомогательная функция, нужна для других важный функций Натуральных чисел.
-inline Natural multiplyByPowerOfTen(Natural& num1, std::size_t k)
+constexpr Natural multiplyByPowerOfTen(Natural& num1, std::size_t k)
 {
-    if (Cmp::execute(num1, Natural({0})) == 0)
+    if (num1.isZero())
 		return num1;
 
 	if (num1.nums.size() > SIZE_MAX - k) {
@@ -121,7 +157,7 @@ inline Natural multiplyByPowerOfTen(Natural& num1, std::size_t k)
 }
 
 // Вспомогательная функция, нужна для других важный функций Натуральных чисел.
-inline Natural multibleByDigit(const Natural& num1, std::size_t b)
+constexpr Natural multibleByDigit(const Natural& num1, std::size_t b)
 {
     if (b > 9) {
         throw UniversalStringException("Natural:  digit out of range (" + std::to_string(b) + ")");
@@ -149,7 +185,7 @@ inline Natural multibleByDigit(const Natural& num1, std::size_t b)
 class Sub : public BinaryOperation<Sub, Natural>
 {
 public:
-    static Natural calc(Natural num1, Natural num2) { 
+    static constexpr Natural calc(Natural num1, Natural num2) { 
         uint8_t cmp = Cmp::execute(num1, num2);
         if (cmp == 1) {
             throw UniversalStringException("Natural:  subtrahend larger than minuend");
@@ -179,7 +215,7 @@ public:
 
 
 // Вспомогательная функция, нужна для других важный функций Натуральных чисел.
-inline Natural subMultipied(const Natural& num1, const Natural& num2, std::size_t c)
+constexpr Natural subMultipied(const Natural& num1, const Natural& num2, std::size_t c)
 {
     if (c > 9)
 		throw UniversalStringException("Natural:  The multiplier is not a digit from 0 to 9!");
@@ -190,46 +226,52 @@ inline Natural subMultipied(const Natural& num1, const Natural& num2, std::size_
 }
 
 
+// Деление столбиком, возвращает пару (частное, остаток). Кратные делителя 1..9 строятся один раз на все деление.
+constexpr std::pair<Natural, Natural> divideWithRemainder(const Natural& num1, const Natural& num2)
+{
+    if (num2.isZero()) {
+        throw UniversalStringException("Natural: can not divide by zero");
+    }
+    if (Cmp::execute(num1, num2) == 1) {
+        return {Natural(std::vector<uint8_t>{0}), num1};
+    }
+    std::vector<Natural> multiples(10);
+    for (std::size_t digit = 1; digit <= 9; ++digit) {
+        multiples[digit] = multibleByDigit(num2, digit);
+    }
+    Natural current(std::vector<uint8_t>{0});
+    std::vector<uint8_t> result;
+    result.reserve(num1.nums.size());
+    for (int i = static_cast<int>(num1.nums.size()) - 1; i >= 0; --i) {
+        current = multiplyByPowerOfTen(current, 1);
+        current = Add::execute(current, Natural(std::vector<uint8_t>{num1.nums[i]}));
+        uint8_t q = 0;
+        if (Cmp::execute(current, num2) != 1) {
+            for (int digit = 9; digit >= 1; --digit) {
+                if (Cmp::execute(current, multiples[digit]) != 1) {
+                    current = Sub::execute(current, multiples[digit]);
+                    q = static_cast<uint8_t>(digit);
+                    break;
+                }
+            }
+        }
+        result.push_back(q);
+    }
+    std::reverse(result.begin(), result.end());
+    while (result.size() > 1 && result.back() == 0) {
+        result.pop_back();
+    }
+    return {Natural(result), current};
+}
+
 /**
  * @brief Деление на натуральных числах.
  */
 class Div : public BinaryOperation<Div, Natural>
 {
 public:
-    static Natural calc(Natural num1, Natural num2) { 
-        if (Cmp::execute(num2, Natural({0})) == 0) {
-            throw UniversalStringException("Natural: can not divide by zero");
-        }
-        if (Cmp::execute(num1, num2) == 1) {
-            return Natural(std::vector<uint8_t>{0});
-        }
-        Natural current(std::vector<uint8_t>{0});
-        std::vector<uint8_t> result;
-        result.reserve(num1.nums.size());
-        for (int i = static_cast<int>(num1.nums.size()) - 1; i >= 0; --i) {
-            current = multiplyByPowerOfTen(current, 1);
-            current = Add::execute(current, Natural(std::vector<uint8_t>{num1.nums[i]}));
-            uint8_t q = 0;
-            if (Cmp::execute(current, num2) != 1) {
-                for (int digit = 9; digit >= 1; --digit) {
-                    Natural candidate = multibleByDigit(num2, static_cast<std::size_t>(digit));
-                    try {
-                        Natural newCurrent = Sub::execute(current, candidate);
-                        q = static_cast<uint8_t>(digit);
-                        current = std::move(newCurrent);
-                        break;
-                    } catch (const UniversalStringException&) {
-                        continue;
-                    }
-                }
-            }
-            result.push_back(q);
-        }
-        std::reverse(result.begin(), result.end());
-        while (result.size() > 1 && result.back() == 0) {
-            result.pop_back();
-        }
-        return Natural(result);
+    static constexpr Natural calc(Natural num1, Natural num2) { 
+        return divideWithRemainder(num1, num2).first;
     }
 };
 
@@ -239,14 +281,11 @@ public:
 class Rem : public BinaryOperation<Rem, Natural>
 {
 public:
-    static Natural calc(Natural num1, Natural num2) { 
-        if (Cmp::execute(num2, Natural({0})) == 0) {
+    static constexpr Natural calc(Natural num1, Natural num2) { 
+        if (num2.isZero()) {
             throw UniversalStringException("Natural:  can not divide by zero");
         }
-        if (Cmp::execute(num1, num2) == 1) return num1;
-        Natural q = Div::execute(num1, num2);
-        Natural product = Mul::execute(num2, q);
-        return Sub::execute(num1, product);
+        return divideWithRemainder(num1, num2).second;
     }
 };
 
@@ -256,16 +295,16 @@ public:
 class Gcd : public BinaryOperation<Gcd, Natural>
 {
 public:
-    static Natural calc(Natural num1, Natural num2) { 
+    static constexpr Natural calc(Natural num1, Natural num2) { 
         Natural first = num1;
         Natural second = num2;
-        if (Cmp::execute(second, Natural({0})) == 0 && Cmp::execute(first, Natural({0})) == 0) {
+        if (second.isZero() && first.isZero()) {
             throw UniversalStringException("Natural: the gcd for two zeros is not uniquely defined");
         }
-        if (Cmp::execute(second, Natural({0})) == 0) {
+        if (second.isZero()) {
             return first;
         }
-        while (Cmp::execute(second, Natural({0})) != 0) {
+        while (!second.isZero()) {
             Natural tmp = Rem::execute(first,  second);
             first = second;
             second = tmp;
@@ -281,8 +320,8 @@ public:
 class Lcm : public BinaryOperation<Lcm, Natural>
 {
 public:
-    static Natural calc(Natural num1, Natural num2) { 
-        if (Cmp::execute(num1, Natural({0})) == 0 || Cmp::execute(num2, Natural({0})) == 0 ) {
+    static constexpr Natural calc(Natural num1, Natural num2) { 
+        if (num1.isZero() || num2.isZero()) {
             throw UniversalStringException("Natural:  the lcm for zeros is not uniquely defined");
         }
         return Div::execute(Mul::execute(num1, num2), Gcd::execute(num1, num2));
@@ -311,6 +350,412 @@ public:
     }
 };
 
+
+/**
+ * @brief Оператор перевода строки из десятичных цифр в натуральное число.
+ * Разделители разрядов ' пропускаются, чтобы принимать запись литералов вида 1'000'000.
+ */
+class fromString : public Mapping<fromString, Natural, std::string_view>
+{
+public:
+    static constexpr Natural calc(std::string_view str) {
+        std::vector<uint8_t> digits;
+        digits.reserve(str.size());
+        for (size_t i = str.size(); i-- > 0;) {
+            char c = str[i];
+            if (c == '\'')
+                continue;
+            if (c < '0' || c > '9')
+                throw UniversalStringException("Natural:  wrong argument, string contains non-digit character");
+            digits.push_back(static_cast<uint8_t>(c - '0'));
+        }
+        if (digits.empty())
+            throw UniversalStringException("Natural:  wrong argument, the string should not be empty");
+        return Natural(digits);
+    }
+};
+
+
+/**
+ * Ниже операции натурального числа с машинным словом. Все они работают за O(n) по числу разрядов,
+ * без построения второго Natural, поэтому их стоит использовать везде, где один из операндов
+ * заведомо помещается в uint64_t (счетчики, степени, модули и тп).
+ */
+
+
+/**
+ * @brief Сложение натурального числа с машинным словом.
+ */
+class AddUi : public Mapping<AddUi, Natural, Natural, std::uint64_t>
+{
+public:
+    static constexpr Natural calc(Natural num, std::uint64_t b) {
+        std::vector<uint8_t> res = std::move(num.nums);
+        res.reserve(res.size() + std::numeric_limits<std::uint64_t>::digits10 + 1);
+        std::uint64_t carry = b;
+        for (size_t i = 0; i < res.size() && carry; ++i) {
+            std::uint64_t s = res[i] + carry % 10;
+            carry /= 10;
+            res[i] = static_cast<uint8_t>(s % 10);
+            carry += s / 10;
+        }
+        while (carry > 0) {
+            res.push_back(static_cast<uint8_t>(carry % 10));
+            carry /= 10;
+        }
+        return Natural(res);
+    }
+};
+
+
+/**
+ * @brief Умножение натурального числа на машинное слово.
+ */
+class MulUi : public Mapping<MulUi, Natural, Natural, std::uint64_t>
+{
+public:
+    static constexpr Natural calc(Natural num, std::uint64_t b) {
+        if (b == 0) return Natural(std::vector<uint8_t>{0});
+        std::vector<uint8_t> res;
+        res.reserve(num.nums.size() + std::numeric_limits<std::uint64_t>::digits10 + 1);
+        unsigned __int128 carry = 0;
+        for (size_t i = 0; i < num.nums.size(); ++i) {
+            unsigned __int128 prod = static_cast<unsigned __int128>(num.nums[i]) * b + carry;
+            res.push_back(static_cast<uint8_t>(prod % 10));
+            carry = prod / 10;
+        }
+        while (carry > 0) {
+            res.push_back(static_cast<uint8_t>(carry % 10));
+            carry /= 10;
+        }
+        return Natural(res);
+    }
+};
+
+
+/**
+ * @brief Деление с остатком натурального числа на машинное слово.
+ * Возвращает пару (частное, остаток).
+ */
+class DivModUi : public Mapping<DivModUi, std::pair<Natural, std::uint64_t>, Natural, std::uint64_t>
+{
+public:
+    static constexpr std::pair<Natural, std::uint64_t> calc(Natural num, std::uint64_t b) {
+        if (b == 0) {
+            throw UniversalStringException("Natural: can not divide by zero");
+        }
+        std::vector<uint8_t> quotient(num.nums.size(), 0);
+        unsigned __int128 rem = 0;
+        for (size_t i = num.nums.size(); i-- > 0;) {
+            rem = rem * 10 + num.nums[i];
+            quotient[i] = static_cast<uint8_t>(rem / b);
+            rem %= b;
+        }
+        return {Natural(quotient), static_cast<std::uint64_t>(rem)};
+    }
+};
+
+
+/**
+ * @brief Проверка того, что натуральное число помещается в машинное слово.
+ */
+class FitsUi : public Mapping<FitsUi, bool, Natural>
+{
+public:
+    static constexpr bool calc(Natural num) {
+        constexpr size_t max_digits = std::numeric_limits<std::uint64_t>::digits10 + 1;
+        if (num.nums.size() < max_digits) return true;
+        if (num.nums.size() > max_digits) return false;
+        std::uint64_t value = 0;
+        for (size_t i = num.nums.size(); i-- > 0;) {
+            if (__builtin_mul_overflow(value, 10, &value) ||
+                __builtin_add_overflow(value, num.nums[i], &value))
+                return false;
+        }
+        return true;
+    }
+};
+
+
+/**
+ * @brief Перевод натурального числа в машинное слово.
+ */
+class ToUi : public Mapping<ToUi, std::uint64_t, Natural>
+{
+public:
+    static constexpr std::uint64_t calc(Natural num) {
+        if (!FitsUi::execute(num)) {
+            throw UniversalStringException("Natural: the number does not fit into uint64_t");
+        }
+        std::uint64_t value = 0;
+        for (size_t i = num.nums.size(); i-- > 0;) {
+            value = value * 10 + num.nums[i];
+        }
+        return value;
+    }
+};
+
+
+/**
+ * @brief Сравнение натурального числа с машинным словом, результат в тех же кодах, что и у Cmp.
+ */
+class CmpUi : public Mapping<CmpUi, int, Natural, std::uint64_t>
+{
+public:
+    static constexpr int calc(Natural num, std::uint64_t b) {
+        if (!FitsUi::execute(num)) return 2;
+        std::uint64_t a = ToUi::execute(num);
+        if (a > b) return 2;
+        if (a < b) return 1;
+        return 0;
+    }
+};
+
+
+/**
+ * @brief Перевод натурального числа в систему счисления с основанием base.
+ * Цифры возвращаются в формате Little-endian, как и в самом Natural.
+ */
+class ToRadix : public Mapping<ToRadix, std::vector<std::uint64_t>, Natural, std::uint64_t>
+{
+public:
+    static constexpr std::vector<std::uint64_t> calc(Natural num, std::uint64_t base) {
+        if (base < 2) {
+            throw UniversalStringException("Natural: radix must be at least 2");
+        }
+        std::vector<std::uint64_t> digits;
+        Natural current = std::move(num);
+        do {
+            auto [quotient, digit] = DivModUi::execute(std::move(current), base);
+            digits.push_back(digit);
+            current = std::move(quotient);
+        } while (!current.isZero());
+        return digits;
+    }
+};
+
+
+/**
+ * @brief Сборка натурального числа из цифр в системе счисления с основанием base (схема Горнера).
+ */
+class FromRadix : public Mapping<FromRadix, Natural, std::vector<std::uint64_t>, std::uint64_t>
+{
+public:
+    static constexpr Natural calc(std::vector<std::uint64_t> digits, std::uint64_t base) {
+        if (base < 2) {
+            throw UniversalStringException("Natural: radix must be at least 2");
+        }
+        Natural result(std::vector<uint8_t>{0});
+        for (size_t i = digits.size(); i-- > 0;) {
+            if (digits[i] >= base) {
+                throw UniversalStringException("Natural: digit out of range for the radix");
+            }
+            result = AddUi::execute(MulUi::execute(std::move(result), base), digits[i]);
+        }
+        return result;
+    }
+};
+
+
+/**
+ * Ниже корни и степени. Корни считаются итерацией Ньютона сверху: начальное приближение заведомо
+ * больше корня, последовательность строго убывает и останавливается ровно на целой части корня.
+ * Каждый шаг - одно деление, число шагов логарифмическое от длины числа.
+ */
+
+
+// Проверка base^k <= n на машинных словах, переполнение означает "больше".
+constexpr bool powWordLeq(std::uint64_t base, std::uint64_t k, std::uint64_t n) {
+    std::uint64_t acc = 1;
+    for (std::uint64_t i = 0; i < k; ++i) {
+        if (__builtin_mul_overflow(acc, base, &acc) || acc > n)
+            return false;
+    }
+    return true;
+}
+
+// Целая часть корня k-й степени из машинного слова (двоичный поиск, корень меньше 2^(64/k + 1)).
+constexpr std::uint64_t irootWord(std::uint64_t n, std::uint64_t k) {
+    if (n < 2 || k == 1) return n;
+    std::uint64_t lo = 1;
+    std::uint64_t hi = k >= 64 ? 2 : (std::uint64_t{1} << (64 / k + 1));
+    while (hi - lo > 1) {
+        std::uint64_t mid = lo + (hi - lo) / 2;
+        if (powWordLeq(mid, k, n)) lo = mid;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// Целая часть квадратного корня из машинного слова (Ньютон, старт с 2^(bits/2 + 1) >= sqrt(n)).
+constexpr std::uint64_t isqrtWord(std::uint64_t n) {
+    if (n < 2) return n;
+    std::uint64_t x = std::uint64_t{1} << ((64 - __builtin_clzll(n)) / 2 + 1);
+    while (true) {
+        std::uint64_t y = (x + n / x) / 2;
+        if (y >= x) return x;
+        x = y;
+    }
+}
+
+// Единица, сдвинутая на k десятичных разрядов, - удобное начальное приближение для корней.
+constexpr Natural powerOfTen(std::size_t k) {
+    Natural one(std::uint64_t{1});
+    return multiplyByPowerOfTen(one, k);
+}
+
+
+/**
+ * @brief Возведение натурального числа в степень, заданную машинным словом (бинарное возведение).
+ */
+class PowUi : public Mapping<PowUi, Natural, Natural, std::uint64_t>
+{
+public:
+    static constexpr Natural calc(Natural num, std::uint64_t k) {
+        Natural result(std::uint64_t{1});
+        Natural base = std::move(num);
+        while (k > 0) {
+            if (k & 1)
+                result = Mul::execute(result, base);
+            k >>= 1;
+            if (k > 0)
+                base = Sqr::execute(base);
+        }
+        return result;
+    }
+};
+
+
+/**
+ * @brief Целая часть квадратного корня: x_{i+1} = (x_i + n / x_i) / 2.
+ */
+class ISqrt : public Mapping<ISqrt, Natural, Natural>
+{
+public:
+    static constexpr Natural calc(Natural num) {
+        if (FitsUi::execute(num))
+            return Natural(isqrtWord(ToUi::execute(num)));
+
+        // 10^ceil(d/2) > sqrt(n), где d - число разрядов
+        Natural x = powerOfTen((num.nums.size() + 1) / 2);
+        while (true) {
+            Natural y = DivModUi::execute(Add::execute(x, Div::execute(num, x)), 2).first;
+            if (Cmp::execute(y, x) != 1)
+                return x;
+            x = std::move(y);
+        }
+    }
+};
+
+
+/**
+ * @brief Целая часть корня k-й степени: x_{i+1} = ((k - 1) x_i + n / x_i^(k-1)) / k.
+ */
+class IRoot : public Mapping<IRoot, Natural, Natural, std::uint64_t>
+{
+public:
+    static constexpr Natural calc(Natural num, std::uint64_t k) {
+        if (k == 0) {
+            throw UniversalStringException("Natural: the root of degree zero is not defined");
+        }
+        if (k == 1 || num.isZero() || num.isOne())
+            return num;
+        if (k == 2)
+            return ISqrt::execute(num);
+        if (FitsUi::execute(num))
+            return Natural(irootWord(ToUi::execute(num), k));
+
+        // n < 10^d < 2^(10d/3), поэтому при k >= 10d/3 корень равен единице
+        std::size_t digits = num.nums.size();
+        if (k >= (10 * digits + 2) / 3)
+            return Natural(std::uint64_t{1});
+
+        Natural x = powerOfTen((digits + k - 1) / k);
+        while (true) {
+            Natural t = Div::execute(num, PowUi::execute(x, k - 1));
+            Natural y = DivModUi::execute(Add::execute(MulUi::execute(x, k - 1), t), k).first;
+            if (Cmp::execute(y, x) != 1)
+                return x;
+            x = std::move(y);
+        }
+    }
+};
+
+
+/**
+ * @brief Проверка на полный квадрат. Сначала отсев по квадратичным вычетам по модулям 64, 63, 65 и 11
+ * (отбрасывает около 99% чисел за одно деление на слово), затем точная проверка через ISqrt.
+ */
+class IsPerfectSquare : public Mapping<IsPerfectSquare, bool, Natural>
+{
+private:
+    static constexpr bool isSquareMod(std::uint64_t r, std::uint64_t m) {
+        for (std::uint64_t x = 0; x <= m / 2; ++x) {
+            if (x * x % m == r) return true;
+        }
+        return false;
+    }
+
+public:
+    static constexpr bool calc(Natural num) {
+        std::uint64_t r = DivModUi::execute(num, 64 * 63 * 65 * 11).second;
+        if (!isSquareMod(r % 64, 64) || !isSquareMod(r % 63, 63) ||
+            !isSquareMod(r % 65, 65) || !isSquareMod(r % 11, 11))
+            return false;
+        Natural root = ISqrt::execute(num);
+        return Cmp::execute(Mul::execute(root, root), num) == 0;
+    }
+};
+
+
+/**
+ * @brief Представление числа в виде полной степени r^e с наибольшим возможным e.
+ * Возвращает пару (r, e), для чисел, которые не являются полной степенью, это (n, 1).
+ * Перебираются только простые показатели p <= log2(n): составной показатель раскладывается на них.
+ */
+class PerfectPower : public Mapping<PerfectPower, std::pair<Natural, std::uint64_t>, Natural>
+{
+private:
+    static constexpr bool isPrimeWord(std::uint64_t p) {
+        if (p < 2) return false;
+        for (std::uint64_t d = 2; d * d <= p; ++d) {
+            if (p % d == 0) return false;
+        }
+        return true;
+    }
+
+public:
+    static constexpr std::pair<Natural, std::uint64_t> calc(Natural num) {
+        std::uint64_t exponent = 1;
+        if (CmpUi::execute(num, 4) == 1)
+            return {num, exponent};
+
+        for (std::uint64_t p = 2; p < (10 * num.nums.size() + 2) / 3 + 1; ++p) {
+            if (!isPrimeWord(p)) continue;
+            while (true) {
+                if (p == 2 && !IsPerfectSquare::execute(num)) break;
+                Natural root = IRoot::execute(num, p);
+                if (root.isOne() || Cmp::execute(PowUi::execute(root, p), num) != 0) break;
+                num = std::move(root);
+                exponent *= p;
+            }
+        }
+        return {num, exponent};
+    }
+};
+
+
+/**
+ * @brief Проверка того, что число является полной степенью r^e, e >= 2.
+ */
+class IsPerfectPower : public Mapping<IsPerfectPower, bool, Natural>
+{
+public:
+    static constexpr bool calc(Natural num) {
+        return PerfectPower::execute(num).second > 1;
+    }
+};
+
 }
 
 /**
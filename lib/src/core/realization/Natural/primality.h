@@ -0,0 +1,266 @@
+#ifndef PRIMALITY_NATURAL_H
+#define PRIMALITY_NATURAL_H
+
+#include <cstdint>
+
+#include "operations.h"
+
+/**
+ * В данном файле проверка натуральных чисел на простоту.
+ *
+ * Числа, помещающиеся в машинное слово, проверяются детерминированным тестом Миллера-Рабина по семи
+ * основаниям (Jaeschke, Sinclair), которых достаточно для всех n < 2^64. Эта версия constexpr, на ней
+ * держится проверка модуля Zp<p> на этапе компиляции.
+ *
+ * Для длинных чисел используется тест BPSW: сильный тест Миллера-Рабина по основанию 2 и сильный тест
+ * Люка с параметрами Селфриджа. Составных чисел, проходящих BPSW, не известно, но и доказательства
+ * их отсутствия нет, поэтому операция называется IsProbablePrime.
+ */
+
+namespace NatOper {
+
+// Простые до 53, ими сначала пробуется деление - отсекает большинство составных за пару делений на слово.
+inline constexpr std::uint64_t small_primes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53};
+
+constexpr std::uint64_t mulModWord(std::uint64_t a, std::uint64_t b, std::uint64_t m) {
+    return static_cast<std::uint64_t>(static_cast<unsigned __int128>(a) * b % m);
+}
+
+constexpr std::uint64_t powModWord(std::uint64_t base, std::uint64_t e, std::uint64_t m) {
+    std::uint64_t result = 1 % m;
+    base %= m;
+    while (e > 0) {
+        if (e & 1) result = mulModWord(result, base, m);
+        base = mulModWord(base, base, m);
+        e >>= 1;
+    }
+    return result;
+}
+
+// Сильный тест Миллера-Рабина для нечетного n > 2 по основанию a.
+constexpr bool millerRabinWord(std::uint64_t n, std::uint64_t a) {
+    a %= n;
+    if (a == 0) return true;
+    std::uint64_t d = n - 1;
+    unsigned s = 0;
+    while ((d & 1) == 0) {
+        d >>= 1;
+        ++s;
+    }
+    std::uint64_t x = powModWord(a, d, n);
+    if (x == 1 || x == n - 1) return true;
+    for (unsigned r = 1; r < s; ++r) {
+        x = mulModWord(x, x, n);
+        if (x == n - 1) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Детерминированная проверка на простоту машинного слова.
+ */
+constexpr bool isPrimeWord(std::uint64_t n) {
+    if (n < 2) return false;
+    for (std::uint64_t p : small_primes) {
+        if (n % p == 0) return n == p;
+    }
+    if (n < 53 * 53) return true;
+    for (std::uint64_t a : {2ULL, 325ULL, 9375ULL, 28178ULL, 450775ULL, 9780504ULL, 1795265022ULL}) {
+        if (!millerRabinWord(n, a)) return false;
+    }
+    return true;
+}
+
+
+// Арифметика по модулю длинного числа, аргументы уже приведены в [0, m).
+constexpr Natural addMod(const Natural& a, const Natural& b, const Natural& m) {
+    Natural sum = Add::execute(a, b);
+    return Cmp::execute(sum, m) == 1 ? sum : Sub::execute(sum, m);
+}
+
+constexpr Natural subMod(const Natural& a, const Natural& b, const Natural& m) {
+    if (Cmp::execute(a, b) != 1) return Sub::execute(a, b);
+    return Sub::execute(Add::execute(a, m), b);
+}
+
+constexpr Natural mulMod(const Natural& a, const Natural& b, const Natural& m) {
+    return Rem::execute(Mul::execute(a, b), m);
+}
+
+constexpr Natural sqrMod(const Natural& a, const Natural& m) {
+    return Rem::execute(Sqr::execute(a), m);
+}
+
+// Деление на 2 по нечетному модулю.
+constexpr Natural halfMod(const Natural& a, const Natural& m) {
+    Natural even = (a.nums[0] & 1) ? Add::execute(a, m) : a;
+    return DivModUi::execute(even, 2).first;
+}
+
+
+/**
+ * @brief Возведение в степень по модулю.
+ */
+class PowMod : public Mapping<PowMod, Natural, Natural, Natural, Natural>
+{
+public:
+    static constexpr Natural calc(Natural base, Natural e, Natural m) {
+        if (m.isZero()) {
+            throw UniversalStringException("Natural: modulus can not be zero");
+        }
+        Natural result = Rem::execute(Natural(std::uint64_t{1}), m);
+        base = Rem::execute(base, m);
+        std::vector<std::uint64_t> bits = ToRadix::execute(e, 2);
+        for (size_t i = bits.size(); i-- > 0;) {
+            result = sqrMod(result, m);
+            if (bits[i]) result = mulMod(result, base, m);
+        }
+        return result;
+    }
+};
+
+
+/**
+ * @brief Сильный тест Миллера-Рабина для нечетного n > 2 по основанию a.
+ */
+class MillerRabin : public Mapping<MillerRabin, bool, Natural, Natural>
+{
+public:
+    static constexpr bool calc(Natural n, Natural a) {
+        Natural one(std::uint64_t{1});
+        Natural n_minus_one = Sub::execute(n, one);
+        a = Rem::execute(a, n);
+        if (a.isZero()) return true;
+
+        Natural d = n_minus_one;
+        std::uint64_t s = 0;
+        while ((d.nums[0] & 1) == 0) {
+            d = DivModUi::execute(d, 2).first;
+            ++s;
+        }
+        Natural x = PowMod::execute(a, d, n);
+        if (x.isOne() || Cmp::execute(x, n_minus_one) == 0) return true;
+        for (std::uint64_t r = 1; r < s; ++r) {
+            x = sqrMod(x, n);
+            if (Cmp::execute(x, n_minus_one) == 0) return true;
+        }
+        return false;
+    }
+};
+
+
+/**
+ * @brief Сильный тест Люка для нечетного n, не являющегося полным квадратом. Параметры по Селфриджу:
+ * D - первое из 5, -7, 9, -11, ... с символом Якоби (D/n) = -1, P = 1, Q = (1 - D) / 4.
+ */
+class StrongLucas : public Mapping<StrongLucas, bool, Natural>
+{
+private:
+    // Символ Якоби (a/n) для нечетного n > 0.
+    static constexpr int jacobiWord(std::uint64_t a, std::uint64_t n) {
+        int result = 1;
+        a %= n;
+        while (a != 0) {
+            while ((a & 1) == 0) {
+                a >>= 1;
+                if (n % 8 == 3 || n % 8 == 5) result = -result;
+            }
+            std::uint64_t tmp = a;
+            a = n;
+            n = tmp;
+            if (a % 4 == 3 && n % 4 == 3) result = -result;
+            a %= n;
+        }
+        return n == 1 ? result : 0;
+    }
+
+    // Символ Якоби (D/n) для малого знакового D через квадратичный закон взаимности.
+    static constexpr int jacobi(std::int64_t D, const Natural& n) {
+        std::uint64_t abs_d = D < 0 ? static_cast<std::uint64_t>(-D) : static_cast<std::uint64_t>(D);
+        std::uint64_t n_mod_4 = DivModUi::execute(n, 4).second;
+        int result = 1;
+        if (D < 0 && n_mod_4 == 3) result = -result;   // (-1/n)
+        // (|D|/n) = (n/|D|) * (-1)^((|D|-1)/2 * (n-1)/2), |D| нечетно
+        if (abs_d % 4 == 3 && n_mod_4 == 3) result = -result;
+        return result * jacobiWord(DivModUi::execute(n, abs_d).second, abs_d);
+    }
+
+    // Приведение малого знакового числа по модулю n.
+    static constexpr Natural signedMod(std::int64_t v, const Natural& n) {
+        Natural abs = Rem::execute(Natural(static_cast<std::uint64_t>(v < 0 ? -v : v)), n);
+        if (v >= 0 || abs.isZero()) return abs;
+        return Sub::execute(n, abs);
+    }
+
+public:
+    static constexpr bool calc(Natural n) {
+        std::int64_t D = 5;
+        while (true) {
+            int j = jacobi(D, n);
+            if (j == -1) break;
+            // (D/n) = 0 означает общий делитель с D
+            if (j == 0 && CmpUi::execute(n, static_cast<std::uint64_t>(D < 0 ? -D : D)) != 0) return false;
+            D = D > 0 ? -(D + 2) : -D + 2;
+        }
+        Natural d_mod = signedMod(D, n);
+        Natural q_mod = signedMod((1 - D) / 4, n);
+
+        // n + 1 = d * 2^s
+        Natural d = AddUi::execute(n, 1);
+        std::uint64_t s = 0;
+        while ((d.nums[0] & 1) == 0) {
+            d = DivModUi::execute(d, 2).first;
+            ++s;
+        }
+
+        // U_k, V_k и Q^k двоичным методом слева направо, P = 1
+        Natural U(std::uint64_t{1});
+        Natural V(std::uint64_t{1});
+        Natural Qk = q_mod;
+        std::vector<std::uint64_t> bits = ToRadix::execute(d, 2);
+        for (size_t i = bits.size() - 1; i-- > 0;) {
+            U = mulMod(U, V, n);
+            V = subMod(sqrMod(V, n), addMod(Qk, Qk, n), n);
+            Qk = sqrMod(Qk, n);
+            if (bits[i]) {
+                Natural next_u = halfMod(addMod(U, V, n), n);
+                Natural next_v = halfMod(addMod(mulMod(d_mod, U, n), V, n), n);
+                U = std::move(next_u);
+                V = std::move(next_v);
+                Qk = mulMod(Qk, q_mod, n);
+            }
+        }
+
+        if (U.isZero() || V.isZero()) return true;
+        for (std::uint64_t r = 1; r < s; ++r) {
+            V = subMod(sqrMod(V, n), addMod(Qk, Qk, n), n);
+            if (V.isZero()) return true;
+            Qk = sqrMod(Qk, n);
+        }
+        return false;
+    }
+};
+
+
+/**
+ * @brief Проверка на простоту. Для n < 2^64 ответ точный, для длинных чисел - тест BPSW.
+ */
+class IsProbablePrime : public Mapping<IsProbablePrime, bool, Natural>
+{
+public:
+    static constexpr bool calc(Natural n) {
+        if (FitsUi::execute(n))
+            return isPrimeWord(ToUi::execute(n));
+
+        for (std::uint64_t p : small_primes) {
+            if (DivModUi::execute(n, p).second == 0) return false;
+        }
+        if (!MillerRabin::execute(n, Natural(std::uint64_t{2}))) return false;
+        if (IsPerfectSquare::execute(n)) return false;
+        return StrongLucas::execute(n);
+    }
+};
+
+}
+
+#endif // PRIMALITY_NATURAL_H
@@ -0,0 +1,329 @@
+#ifndef SIEVE_NATURAL_H
+#define SIEVE_NATURAL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "primality.h"
+
+/**
+ * В данном файле перечисление простых чисел в пределах машинного слова.
+ *
+ * Основа - сегментированное решето Эратосфена: диапазон режется на куски по 32 КиБ (помещаются в кэш L1),
+ * в куске хранятся только нечетные числа, а кратные 3, 5, 7, 11 и 13 не вычеркиваются по одному, а
+ * копируются готовым периодическим шаблоном (колесо). Большие диапазоны делятся между потоками.
+ *
+ * Поверх решета:
+ *  - PrimeTable - общая таблица простых, которая достраивается по мере надобности;
+ *  - PrimeRange - перебор простых из [lo, hi) в range-for без хранения всего списка;
+ *  - nttPrimes / crtPrimes / primitiveRoot - подбор модулей для модулярных алгоритмов.
+ */
+
+namespace Primes {
+
+// Число нечетных чисел в одном сегменте: байт на число, 32 КиБ на сегмент.
+inline constexpr std::uint64_t segment_odds = std::uint64_t{1} << 15;
+
+// Диапазоны короче этого решаются в одном потоке: запуск потоков дороже самого решета.
+inline constexpr std::uint64_t parallel_threshold = std::uint64_t{1} << 24;
+
+// Простые, которые учтены в шаблоне колеса, и период шаблона в нечетных числах (3 * 5 * 7 * 11 * 13).
+inline constexpr std::uint64_t wheel_primes[] = {3, 5, 7, 11, 13};
+inline constexpr std::uint64_t wheel_period = 15015;
+
+
+/**
+ * @brief Простые не больше n обычным решетом по нечетным. Годится для вычислений на этапе компиляции
+ * и для малых n, все остальное идет через сегментированное решето.
+ */
+constexpr std::vector<std::uint64_t> primesUpTo(std::uint64_t n) {
+    std::vector<std::uint64_t> primes;
+    if (n < 2) return primes;
+    primes.push_back(2);
+    std::vector<uint8_t> composite((n - 1) / 2, 0);   // composite[i] отвечает числу 2i + 3
+    for (std::uint64_t i = 0; i < composite.size(); ++i) {
+        if (composite[i]) continue;
+        std::uint64_t p = 2 * i + 3;
+        primes.push_back(p);
+        for (std::uint64_t j = (p * p - 3) / 2; j < composite.size(); j += p) {
+            composite[j] = 1;
+        }
+    }
+    return primes;
+}
+
+
+// Шаблон колеса: wheel[i] = 1, если нечетное число 2i + 1 делится на одно из wheel_primes.
+inline const std::vector<uint8_t>& wheelPattern() {
+    static const std::vector<uint8_t> pattern = [] {
+        std::vector<uint8_t> result(wheel_period, 0);
+        for (std::uint64_t i = 0; i < wheel_period; ++i) {
+            for (std::uint64_t p : wheel_primes) {
+                if ((2 * i + 1) % p == 0) result[i] = 1;
+            }
+        }
+        return result;
+    }();
+    return pattern;
+}
+
+// Простые из [lo, hi) дописываются в out. base - все простые до sqrt(hi), сегмент не длиннее segment_odds.
+inline void sieveSegment(std::uint64_t lo, std::uint64_t hi, const std::vector<std::uint64_t>& base,
+                         std::vector<std::uint64_t>& out) {
+    if (lo <= 2 && 2 < hi) out.push_back(2);
+    std::uint64_t first = lo | 1;
+    if (first >= hi) return;
+    std::uint64_t count = (hi - first + 1) / 2;
+
+    const std::vector<uint8_t>& wheel = wheelPattern();
+    std::vector<uint8_t> composite(count);
+    std::uint64_t offset = (first / 2) % wheel_period;
+    for (std::uint64_t k = 0; k < count; ++k) {
+        composite[k] = wheel[offset];
+        if (++offset == wheel_period) offset = 0;
+    }
+    for (std::uint64_t p : wheel_primes) {
+        if (first <= p && p < hi) composite[(p - first) / 2] = 0;
+    }
+
+    for (std::uint64_t p : base) {
+        if (p <= wheel_primes[std::size(wheel_primes) - 1]) continue;
+        if (p > (hi - 1) / p) break;
+        std::uint64_t start = std::max(p * p, (first + p - 1) / p * p);
+        if ((start & 1) == 0) start += p;
+        for (std::uint64_t j = (start - first) / 2; j < count; j += p) {
+            composite[j] = 1;
+        }
+    }
+
+    for (std::uint64_t k = 0; k < count; ++k) {
+        std::uint64_t value = first + 2 * k;
+        if (!composite[k] && value > 1) out.push_back(value);
+    }
+}
+
+// Простые из [lo, hi) в одном потоке, сегмент за сегментом.
+inline void sieveRange(std::uint64_t lo, std::uint64_t hi, const std::vector<std::uint64_t>& base,
+                       std::vector<std::uint64_t>& out) {
+    while (lo < hi) {
+        std::uint64_t seg_hi = hi - lo > 2 * segment_odds ? lo + 2 * segment_odds : hi;
+        sieveSegment(lo, seg_hi, base, out);
+        lo = seg_hi;
+    }
+}
+
+
+/**
+ * @brief Все простые из [lo, hi). threads = 0 - по числу ядер, на коротких диапазонах поток всегда один.
+ */
+inline std::vector<std::uint64_t> primesInRange(std::uint64_t lo, std::uint64_t hi, unsigned threads = 0) {
+    std::vector<std::uint64_t> result;
+    if (lo >= hi) return result;
+    std::vector<std::uint64_t> base = primesUpTo(NatOper::isqrtWord(hi - 1));
+
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (threads == 1 || hi - lo < parallel_threshold) {
+        sieveRange(lo, hi, base, result);
+        return result;
+    }
+
+    // Каждый поток получает непрерывный кусок, результаты склеиваются по порядку.
+    std::uint64_t chunk = (hi - lo + threads - 1) / threads;
+    std::vector<std::vector<std::uint64_t>> parts(threads);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        std::uint64_t part_lo = lo + std::min<std::uint64_t>(hi - lo, chunk * t);
+        std::uint64_t part_hi = lo + std::min<std::uint64_t>(hi - lo, chunk * (t + 1));
+        workers.emplace_back([&, t, part_lo, part_hi] { sieveRange(part_lo, part_hi, base, parts[t]); });
+    }
+    for (std::thread& worker : workers) worker.join();
+    for (const std::vector<std::uint64_t>& part : parts) {
+        result.insert(result.end(), part.begin(), part.end());
+    }
+    return result;
+}
+
+
+/**
+ * @brief Общая таблица простых чисел. Растет удвоением границы, читать ее можно из нескольких потоков.
+ */
+class PrimeTable {
+private:
+    std::vector<std::uint64_t> primes;
+    std::uint64_t limit = 2;   // в таблице все простые меньше limit
+    mutable std::shared_mutex lock;
+
+    void growTo(std::uint64_t n) {
+        std::unique_lock guard(lock);
+        if (n < limit) return;
+        std::uint64_t new_limit = std::max(n + 1, 2 * limit);
+        std::vector<std::uint64_t> fresh = primesInRange(limit, new_limit);
+        primes.insert(primes.end(), fresh.begin(), fresh.end());
+        limit = new_limit;
+    }
+
+public:
+    static PrimeTable& instance() {
+        static PrimeTable table;
+        return table;
+    }
+
+    // Все простые p <= n.
+    std::vector<std::uint64_t> upTo(std::uint64_t n) {
+        {
+            std::shared_lock guard(lock);
+            if (n < limit) {
+                auto end = std::upper_bound(primes.begin(), primes.end(), n);
+                return std::vector<std::uint64_t>(primes.begin(), end);
+            }
+        }
+        growTo(n);
+        return upTo(n);
+    }
+
+    // i-е простое число, нумерация с нуля: nth(0) = 2.
+    std::uint64_t nth(std::size_t i) {
+        while (true) {
+            {
+                std::shared_lock guard(lock);
+                if (i < primes.size()) return primes[i];
+            }
+            growTo(2 * bound());
+        }
+    }
+
+    std::uint64_t bound() const {
+        std::shared_lock guard(lock);
+        return limit;
+    }
+};
+
+
+/**
+ * @brief Перебор простых из [lo, hi) по одному сегменту за раз.
+ *
+ * @code
+ * for (std::uint64_t p : Primes::PrimeRange(1'000'000, 2'000'000)) { ... }
+ * @endcode
+ */
+class PrimeRange {
+private:
+    std::uint64_t lo;
+    std::uint64_t hi;
+
+public:
+    class iterator {
+    private:
+        std::vector<std::uint64_t> buffer;
+        std::size_t pos = 0;
+        std::uint64_t next_lo = 0;
+        std::uint64_t hi = 0;
+
+        // Сеет следующие сегменты, пока не найдется хотя бы одно простое или не кончится диапазон.
+        void refill() {
+            buffer.clear();
+            pos = 0;
+            while (buffer.empty() && next_lo < hi) {
+                std::uint64_t seg_hi = hi - next_lo > 2 * segment_odds ? next_lo + 2 * segment_odds : hi;
+                std::vector<std::uint64_t> base = PrimeTable::instance().upTo(NatOper::isqrtWord(seg_hi - 1));
+                sieveSegment(next_lo, seg_hi, base, buffer);
+                next_lo = seg_hi;
+            }
+        }
+
+    public:
+        iterator() = default;
+        iterator(std::uint64_t from, std::uint64_t to) : next_lo(from), hi(to) { refill(); }
+
+        std::uint64_t operator*() const { return buffer[pos]; }
+
+        iterator& operator++() {
+            if (++pos == buffer.size()) refill();
+            return *this;
+        }
+
+        // Итератор кончается, когда буфер пуст, так что сравнивать достаточно с концом.
+        bool operator==(const iterator& other) const {
+            return buffer.empty() && other.buffer.empty();
+        }
+    };
+
+    PrimeRange(std::uint64_t lo, std::uint64_t hi) : lo(lo), hi(hi) {}
+
+    iterator begin() const { return iterator(lo, hi); }
+    iterator end() const { return iterator(); }
+};
+
+
+/**
+ * @brief Простые вида c * 2^k + 1, меньшие bound, по убыванию. По такому модулю есть корень из единицы
+ * степени 2^k, то есть NTT длины до 2^k.
+ */
+constexpr std::vector<std::uint64_t> nttPrimes(unsigned k, std::size_t count,
+                                               std::uint64_t bound = std::uint64_t{1} << 62) {
+    std::vector<std::uint64_t> result;
+    if (k >= 63) return result;
+    std::uint64_t step = std::uint64_t{1} << k;
+    for (std::uint64_t c = (bound - 2) / step; c > 0 && result.size() < count; --c) {
+        std::uint64_t p = c * step + 1;
+        if (NatOper::isPrimeWord(p)) result.push_back(p);
+    }
+    return result;
+}
+
+/**
+ * @brief Наибольшие простые, меньшие bound, по убыванию. Для CRT: при фиксированном числе модулей
+ * их произведение максимально, а запас до bound оставляет место под ленивые сложения.
+ */
+constexpr std::vector<std::uint64_t> crtPrimes(std::size_t count, std::uint64_t bound = std::uint64_t{1} << 62) {
+    std::vector<std::uint64_t> result;
+    for (std::uint64_t p = (bound - 1) | 1; p > 2 && result.size() < count; p -= 2) {
+        if (NatOper::isPrimeWord(p)) result.push_back(p);
+    }
+    return result;
+}
+
+/**
+ * @brief Наименьший первообразный корень по простому модулю p. p - 1 раскладывается пробным делением,
+ * так что функция рассчитана на модули вида c * 2^k + 1 с небольшим c (см. nttPrimes).
+ */
+constexpr std::uint64_t primitiveRoot(std::uint64_t p) {
+    if (p == 2) return 1;
+    std::vector<std::uint64_t> factors;
+    std::uint64_t rest = p - 1;
+    for (std::uint64_t d = 2; d * d <= rest; d += (d == 2 ? 1 : 2)) {
+        if (rest % d != 0) continue;
+        factors.push_back(d);
+        while (rest % d == 0) rest /= d;
+    }
+    if (rest > 1) factors.push_back(rest);
+
+    for (std::uint64_t g = 2;; ++g) {
+        bool is_root = true;
+        for (std::uint64_t q : factors) {
+            if (NatOper::powModWord(g, (p - 1) / q, p) == 1) {
+                is_root = false;
+                break;
+            }
+        }
+        if (is_root) return g;
+    }
+}
+
+/**
+ * @brief Корень из единицы степени n по простому модулю p (n должно делить p - 1).
+ */
+constexpr std::uint64_t rootOfUnity(std::uint64_t p, std::uint64_t n) {
+    if (n == 0 || (p - 1) % n != 0) {
+        throw UniversalStringException("Primes: the root of unity of this order does not exist");
+    }
+    return NatOper::powModWord(primitiveRoot(p), (p - 1) / n, p);
+}
+
+}
+
+#endif // SIEVE_NATURAL_H
@@ -1,10 +1,15 @@
 #ifndef POLYNOMIAL_STRUCTURE_H
 #define POLYNOMIAL_STRUCTURE_H
 
+#include <tuple>
+
 #include "../../abstract/types/polynom.h"
 #include "../../abstract/structures/groups.h"
 #include "../../abstract/structures/rings.h"
 #include "../Polynomial/operations.h"
+#include "../Polynomial/gcd.h"
+#include "../Polynomial/kronecker.h"   // умножение P<Q> подстановкой Кронекера
+#include "../Polynomial/modular_gcd.h"  // НОД P<Q> по модулярным образам
 
 /**
  * @brief Обертка полиномов с операторами.
@@ -54,6 +59,10 @@ public:
         return P(Poly::Derivative<T>::execute(value));
     }
 
+    T evaluate(const T& x) const {
+        return Poly::Evaluate<T>::execute(value, x);
+    }
+
     bool operator==(const P& other) const {
         if (value.coefficients.size() != other.value.coefficients.size())
             return false;
@@ -78,6 +87,17 @@ public:
         return value.coefficients[i];
     }
 
+    // Нормированный НОД; для длинных полиномов через half-GCD, над Q - модулярный.
+    static P gcd(const P& a, const P& b) {
+        return P(Poly::Gcd<T>::execute(a.value, b.value));
+    }
+
+    // g = s a + t b, возвращает {g, s, t}.
+    static std::tuple<P, P, P> extendedGcd(const P& a, const P& b) {
+        Poly::Bezout<T> r = Poly::ExtendedGcd<T>::execute(a.value, b.value);
+        return {P(std::move(r.g)), P(std::move(r.s)), P(std::move(r.t))};
+    }
+
     static P zero() {
         return P({T::zero()});
     }
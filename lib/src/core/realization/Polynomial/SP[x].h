@@ -0,0 +1,120 @@
+#ifndef SPARSE_POLYNOMIAL_STRUCTURE_H
+#define SPARSE_POLYNOMIAL_STRUCTURE_H
+
+#include "../../abstract/types/sparse_polynom.h"
+#include "P[x].h"
+#include "sparse.h"
+
+/**
+ * @brief Обертка разреженных полиномов с операторами, пара к P<T>.
+ * Структура: кольцо (не поле!)
+ *
+ * Хранит только ненулевые члены; умножение и деление сами переходят к плотной записи, когда оба операнда
+ * плотные (см. Sparse::dense_ratio). Перевод между записями явный: fromDense и toDense.
+ *
+ * @code
+ * SP<Q> f = SP<Q>::monomial(Q::identity(), 1000000) + SP<Q>::identity();   // x^1000000 + 1
+ * @endcode
+ *
+ * @tparam T Тип поля коэффициентов (должен удовлетворять Field)
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class SP {
+private:
+    SparsePolynomial<T> value;
+
+public:
+    using AdditionOp = Sparse::Add<T>;
+    using MultiplicationOp = Sparse::Mul<T>;
+    using SetType = SparsePolynomial<T>;
+
+    SP(SparsePolynomial<T> v) : value(std::move(v)) {}
+    SP(std::vector<SparseTerm<T>> terms) : value(std::move(terms)) {}
+
+    SP operator+(const SP& other) const {
+        return SP(Sparse::Add<T>::execute(value, other.value));
+    }
+
+    SP operator*(const SP& other) const {
+        return SP(Sparse::Mul<T>::execute(value, other.value));
+    }
+
+    SP operator-(const SP& other) const {
+        return SP(Sparse::Sub<T>::execute(value, other.value));
+    }
+
+    SP operator/(const SP& other) const {
+        return SP(Sparse::Div<T>::execute(value, other.value));
+    }
+
+    SP operator%(const SP& other) const {
+        return SP(Sparse::Rem<T>::execute(value, other.value));
+    }
+
+    SP operator*(const T& scalar) const {
+        return SP(Sparse::MulScalar<T>::execute(value, scalar));
+    }
+
+    SP derivative() const {
+        return SP(Sparse::Derivative<T>::execute(value));
+    }
+
+    T evaluate(const T& x) const {
+        return Sparse::Evaluate<T>::execute(value, x);
+    }
+
+    bool operator==(const SP& other) const {
+        if (value.terms.size() != other.value.terms.size())
+            return false;
+        for (size_t i = 0; i < value.terms.size(); ++i) {
+            if (value.terms[i].exponent != other.value.terms[i].exponent ||
+                !(value.terms[i].coefficient == other.value.terms[i].coefficient))
+                return false;
+        }
+        return true;
+    }
+
+    std::uint64_t degree() const {
+        return value.degree();
+    }
+
+    // Число ненулевых членов.
+    size_t size() const {
+        return value.terms.size();
+    }
+
+    bool isDense() const {
+        return Sparse::isDense(value);
+    }
+
+    std::string toString() const {
+        return Sparse::toString<T>::execute(value);
+    }
+
+    static SP fromDense(const P<T>& poly) {
+        return SP(Sparse::FromDense<T>::execute(poly.get()));
+    }
+
+    P<T> toDense() const {
+        return P<T>(Sparse::ToDense<T>::execute(value));
+    }
+
+    // coeff * x^exponent
+    static SP monomial(const T& coeff, std::uint64_t exponent) {
+        return SP(std::vector<SparseTerm<T>>{{exponent, coeff}});
+    }
+
+    static SP zero() {
+        return SP(SparsePolynomial<T>());
+    }
+
+    static SP identity() {
+        T one = T::identity();
+        return monomial(one, 0);
+    }
+
+    const SparsePolynomial<T>& get() const { return value; }
+};
+
+#endif //SPARSE_POLYNOMIAL_STRUCTURE_H
@@ -0,0 +1,209 @@
+#ifndef GCD_POLYNOM_H
+#define GCD_POLYNOM_H
+
+#include <tuple>
+
+#include "../../abstract/structures/factor.h"
+#include "operations.h"
+
+/**
+ * В данном файле НОД полиномов над полем с коэффициентами Безу.
+ *
+ * Короткие полиномы идут обычным алгоритмом Евклида. Для длинных - half-GCD: матрица первой половины шагов
+ * Евклида считается рекурсивно по старшим половинам коэффициентов, поэтому НОД стоит O(M(n) log n)
+ * вместо O(n^2). Последовательность остатков та же, что у Евклида, просто большинство промежуточных
+ * остатков не строится.
+ */
+
+namespace Poly {
+
+/**
+ * @brief Длина, с которой выгоден half-GCD. Над Zp умножение быстрое (NTT), поэтому порог ниже.
+ */
+template<typename T>
+struct HalfGcdThreshold {
+    static constexpr size_t value = 128;
+};
+
+template<typename R, typename I>
+struct HalfGcdThreshold<FactorField<R, I>> {
+    static constexpr size_t value = 48;
+};
+
+
+template<typename T>
+bool isZeroPoly(const Polynomial<T>& p) {
+    return p.coefficients.size() == 1 && p.coefficients[0] == T::zero();
+}
+
+// Степень со знаком: у нулевого полинома -1.
+template<typename T>
+long degreeOf(const Polynomial<T>& p) {
+    return isZeroPoly(p) ? -1 : static_cast<long>(p.coefficients.size()) - 1;
+}
+
+// a div x^k
+template<typename T>
+Polynomial<T> shiftDown(const Polynomial<T>& p, size_t k) {
+    if (k >= p.coefficients.size()) return Polynomial<T>({T::zero()});
+    return Polynomial<T>(std::vector<T>(p.coefficients.begin() + k, p.coefficients.end()));
+}
+
+
+/**
+ * @brief Матрица 2x2 над полиномами, действует на столбец (a, b).
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+struct Matrix2 {
+    Polynomial<T> m11, m12, m21, m22;
+
+    static Matrix2 identity() {
+        T unit = T::identity();
+        Polynomial<T> one(std::vector<T>{unit}), zero({T::zero()});
+        return {one, zero, zero, one};
+    }
+
+    // Шаг Евклида (a, b) -> (b, a - q b).
+    static Matrix2 step(const Polynomial<T>& q) {
+        T unit = T::identity();
+        Polynomial<T> one(std::vector<T>{unit}), zero({T::zero()});
+        return {zero, one, one, Sub<T>::execute(zero, q)};
+    }
+
+    std::pair<Polynomial<T>, Polynomial<T>> apply(const Polynomial<T>& a, const Polynomial<T>& b) const {
+        return {Add<T>::execute(Mul<T>::execute(m11, a), Mul<T>::execute(m12, b)),
+                Add<T>::execute(Mul<T>::execute(m21, a), Mul<T>::execute(m22, b))};
+    }
+
+    // this * other: сначала other, потом this.
+    Matrix2 after(const Matrix2& other) const {
+        return {Add<T>::execute(Mul<T>::execute(m11, other.m11), Mul<T>::execute(m12, other.m21)),
+                Add<T>::execute(Mul<T>::execute(m11, other.m12), Mul<T>::execute(m12, other.m22)),
+                Add<T>::execute(Mul<T>::execute(m21, other.m11), Mul<T>::execute(m22, other.m21)),
+                Add<T>::execute(Mul<T>::execute(m21, other.m12), Mul<T>::execute(m22, other.m22))};
+    }
+};
+
+
+/**
+ * @brief Half-GCD: при deg a > deg b матрица M шагов Евклида, после которых (a', b') = M (a, b) и
+ * deg a' >= m > deg b', где m = ceil(deg a / 2).
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class HalfGcd : public Mapping<HalfGcd<T>, Matrix2<T>, Polynomial<T>, Polynomial<T>>
+{
+public:
+    static Matrix2<T> calc(Polynomial<T> a, Polynomial<T> b) {
+        long m = (degreeOf(a) + 1) / 2;
+        if (degreeOf(b) < m) return Matrix2<T>::identity();
+
+        if (a.coefficients.size() < HalfGcdThreshold<T>::value) {
+            Matrix2<T> steps = Matrix2<T>::identity();
+            while (degreeOf(b) >= m) {
+                auto [q, r] = DivRem<T>::execute(a, b);
+                steps = Matrix2<T>::step(q).after(steps);
+                a = std::move(b);
+                b = std::move(r);
+            }
+            return steps;
+        }
+
+        // Первая половина шагов определяется старшими коэффициентами.
+        Matrix2<T> first = HalfGcd<T>::execute(shiftDown(a, m), shiftDown(b, m));
+        auto [c, d] = first.apply(a, b);
+        if (degreeOf(d) < m) return first;
+
+        auto [q, e] = DivRem<T>::execute(c, d);
+        Matrix2<T> steps = Matrix2<T>::step(q).after(first);
+        if (degreeOf(e) < m) return steps;
+
+        size_t k = static_cast<size_t>(2 * m - degreeOf(d));
+        Matrix2<T> second = HalfGcd<T>::execute(shiftDown(d, k), shiftDown(e, k));
+        return second.after(steps);
+    }
+};
+
+
+/**
+ * @brief НОД с коэффициентами Безу: s a + t b = g, g нормирован (старший коэффициент 1).
+ */
+template<typename T>
+struct Bezout {
+    Polynomial<T> g;
+    Polynomial<T> s;
+    Polynomial<T> t;
+};
+
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class ExtendedGcd : public Mapping<ExtendedGcd<T>, Bezout<T>, Polynomial<T>, Polynomial<T>>
+{
+private:
+    // Итоговая матрица M с M (a, b) = (g, 0). Без track матрица не копится - только для самого НОД.
+    template<bool track>
+    static Matrix2<T> reduceToGcd(Polynomial<T>& a, Polynomial<T>& b) {
+        Matrix2<T> total = Matrix2<T>::identity();
+        while (!isZeroPoly(b)) {
+            if (a.coefficients.size() >= HalfGcdThreshold<T>::value) {
+                Matrix2<T> half = HalfGcd<T>::execute(a, b);
+                std::tie(a, b) = half.apply(a, b);
+                if constexpr (track) total = half.after(total);
+                if (isZeroPoly(b)) break;
+            }
+            auto [q, r] = DivRem<T>::execute(a, b);
+            if constexpr (track) total = Matrix2<T>::step(q).after(total);
+            a = std::move(b);
+            b = std::move(r);
+        }
+        return total;
+    }
+
+    // Первый шаг делает deg a > deg b, как требует HalfGcd.
+    static Matrix2<T> ordered(const Polynomial<T>& a, const Polynomial<T>& b) {
+        if (isZeroPoly(a) && isZeroPoly(b))
+            throw UniversalStringException("Polynomial: gcd of two zero polynomials is undefined");
+        Matrix2<T> start = Matrix2<T>::identity();
+        if (degreeOf(a) < degreeOf(b)) return {start.m12, start.m11, start.m22, start.m21};
+        if (!isZeroPoly(b) && degreeOf(a) == degreeOf(b)) return Matrix2<T>::step(DivRem<T>::execute(a, b).first);
+        return start;
+    }
+
+    static Polynomial<T> monic(const Polynomial<T>& p, const T& inv) {
+        return MulScalar<T>::execute(p, inv);
+    }
+
+public:
+    static Bezout<T> calc(Polynomial<T> a, Polynomial<T> b) {
+        Matrix2<T> start = ordered(a, b);
+        auto [a1, b1] = start.apply(a, b);
+        Matrix2<T> total = reduceToGcd<true>(a1, b1).after(start);
+
+        T one = T::identity();
+        T inv = one / a1.coefficients.back();
+        return {monic(a1, inv), monic(total.m11, inv), monic(total.m12, inv)};
+    }
+
+    // Только нормированный НОД, без коэффициентов Безу.
+    static Polynomial<T> gcdOnly(Polynomial<T> a, Polynomial<T> b) {
+        auto [a1, b1] = ordered(a, b).apply(a, b);
+        reduceToGcd<false>(a1, b1);
+        T one = T::identity();
+        return monic(a1, one / a1.coefficients.back());
+    }
+};
+
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class Gcd : public BinaryOperation<Gcd<T>, Polynomial<T>>
+{
+public:
+    static Polynomial<T> calc(Polynomial<T> a, Polynomial<T> b) {
+        return ExtendedGcd<T>::gcdOnly(a, b);
+    }
+};
+
+}
+
+#endif //GCD_POLYNOM_H
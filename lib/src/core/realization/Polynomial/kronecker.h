@@ -0,0 +1,203 @@
+#ifndef KRONECKER_POLYNOM_H
+#define KRONECKER_POLYNOM_H
+
+#include <span>
+#include <vector>
+
+#include "../Rational/Q.h"
+#include "ntt.h"
+#include "operations.h"
+
+/**
+ * В данном файле умножение полиномов подстановкой Кронекера: коэффициенты пакуются в одно длинное число
+ * A(10^w), числа перемножаются, и коэффициенты произведения читаются по слотам из w цифр.
+ *
+ * Знаки: упакованное значение - целое со знаком, коэффициенты произведения читаются сбалансированными
+ * цифрами из (-10^w / 2, 10^w / 2], поэтому ширина слота берется с запасом в одну цифру.
+ * Длинное произведение считается сверткой десятичных цифр через NTT (Natural умножает столбиком).
+ * P<Q> сначала приводится к общему знаменателю, после умножения дроби остаются несокращенными (см. Rat::Normalize).
+ */
+
+namespace Kronecker {
+
+// Короче этого свертка цифр через NTT не окупается.
+inline constexpr std::size_t ntt_digits = 64;
+
+/**
+ * @brief Произведение десятичных записей: свертка цифр по NTT-простому около 2^62 (суммы 81 * len
+ * помещаются без переполнения) и один проход переносов.
+ */
+inline Natural multiplyDigits(const Natural& a, const Natural& b) {
+    if (a.isZero() || b.isZero()) return Natural(std::uint64_t{0});
+    if (std::min(a.nums.size(), b.nums.size()) < ntt_digits) return NatOper::Mul::execute(a, b);
+
+    const Ntt::Tables& tables = Ntt::crtModuli().tables[0];
+    std::vector<std::uint64_t> da(a.nums.begin(), a.nums.end());
+    std::vector<std::uint64_t> db(b.nums.begin(), b.nums.end());
+    std::size_t length = da.size() + db.size() - 1;
+    std::vector<std::uint64_t> columns = Ntt::cyclic(da, Ntt::imageOf(db, Ntt::transformSize(length), tables), tables);
+
+    std::vector<uint8_t> digits;
+    digits.reserve(length + 20);
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i < length; ++i) {
+        carry += columns[i];
+        digits.push_back(static_cast<uint8_t>(carry % 10));
+        carry /= 10;
+    }
+    for (; carry > 0; carry /= 10) digits.push_back(static_cast<uint8_t>(carry % 10));
+    return Natural(digits);
+}
+
+inline std::size_t digitsOf(const Z& num) {
+    return Int::Abs::execute(num.get()).get().nums.size();
+}
+
+// A(10^w) со знаком: положительные и отрицательные коэффициенты пакуются отдельно.
+inline Z pack(std::span<const Z> coeffs, std::size_t width) {
+    std::vector<uint8_t> positive(coeffs.size() * width, 0), negative(coeffs.size() * width, 0);
+    for (std::size_t i = 0; i < coeffs.size(); ++i) {
+        if (coeffs[i].isZero()) continue;
+        std::vector<uint8_t>& target = coeffs[i].isNegative() ? negative : positive;
+        const Natural abs = Int::Abs::execute(coeffs[i].get()).get();
+        std::copy(abs.nums.begin(), abs.nums.end(), target.begin() + i * width);
+    }
+    return Z(Natural(positive), false) - Z(Natural(negative), false);
+}
+
+// Чтение count сбалансированных слотов из |значения|, знак значения переносится на все коэффициенты.
+inline std::vector<Z> unpack(const Natural& value, bool negative, std::size_t width, std::size_t count) {
+    Natural base = NatOper::powerOfTen(width);
+    Natural half = NatOper::MulUi::execute(NatOper::powerOfTen(width - 1), 5);
+    std::vector<Z> coeffs;
+    coeffs.reserve(count);
+    bool carry = false;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t from = std::min(i * width, value.nums.size());
+        std::size_t to = std::min(from + width, value.nums.size());
+        Natural slot = from == to ? Natural(std::uint64_t{0})
+                                  : Natural(std::vector<uint8_t>(value.nums.begin() + from, value.nums.begin() + to));
+        if (carry) slot = NatOper::AddUi::execute(slot, 1);
+        carry = NatOper::Cmp::execute(slot, half) == 2;
+        Z digit(slot, false);
+        if (carry) digit = digit - Z(base, false);
+        if (negative) digit = -digit;
+        coeffs.push_back(std::move(digit));
+    }
+    return coeffs;
+}
+
+// Ширина слота: |c_k| <= min(n, m) max|a| max|b| < 10^(digits), и еще одна цифра под знак.
+inline std::size_t slotWidth(std::span<const Z> a, std::span<const Z> b) {
+    std::size_t max_a = 1, max_b = 1;
+    for (const Z& c : a) max_a = std::max(max_a, digitsOf(c));
+    for (const Z& c : b) max_b = std::max(max_b, digitsOf(c));
+    std::size_t terms = Natural(static_cast<std::uint64_t>(std::min(a.size(), b.size()))).nums.size();
+    return terms + max_a + max_b + 1;
+}
+
+inline std::vector<Z> multiplyPacked(std::span<const Z> a, std::span<const Z> b, std::size_t width) {
+    Z pa = pack(a, width), pb = pack(b, width);
+    Natural product = multiplyDigits(Int::Abs::execute(pa.get()).get(), Int::Abs::execute(pb.get()).get());
+    return unpack(product, pa.isNegative() != pb.isNegative(), width, a.size() + b.size() - 1);
+}
+
+/**
+ * @brief Произведение полиномов с целыми коэффициентами (младшие степени первыми).
+ */
+class MulInteger : public Mapping<MulInteger, std::vector<Z>, std::vector<Z>, std::vector<Z>>
+{
+public:
+    static std::vector<Z> calc(std::vector<Z> a, std::vector<Z> b) {
+        if (a.empty() || b.empty()) return {};
+        return multiplyPacked(a, b, slotWidth(a, b));
+    }
+};
+
+/**
+ * @brief Коэффициенты над общим знаменателем: a_i = A_i / L.
+ */
+struct Cleared {
+    std::vector<Z> numerators;
+    N denominator;
+};
+
+inline Cleared clearDenominators(const std::vector<Q>& coeffs) {
+    std::vector<Rational> reduced;
+    reduced.reserve(coeffs.size());
+    Z common(std::int64_t{1});
+    for (const Q& c : coeffs) {
+        reduced.push_back(Rat::Normalize::execute(c.get()));
+        if (!reduced.back().denominator.isOne()) common = Z::lcm(common, Z(reduced.back().denominator));
+    }
+
+    Cleared result{{}, Int::Abs::execute(common.get())};
+    result.numerators.reserve(coeffs.size());
+    for (const Rational& r : reduced) {
+        result.numerators.push_back(r.denominator.isOne() ? r.numerator * common
+                                                          : r.numerator * (common / Z(r.denominator)));
+    }
+    return result;
+}
+
+inline std::vector<Q> overDenominator(std::vector<Z> product, const N& denominator) {
+    bool unreduced = !denominator.isOne();
+    std::vector<Q> result;
+    result.reserve(product.size());
+    for (Z& c : product) result.push_back(Q(Rational(std::move(c), denominator, unreduced)));
+    return result;
+}
+
+/**
+ * @brief Произведение полиномов над Q через общий знаменатель и упаковку.
+ */
+class MulRational : public Mapping<MulRational, std::vector<Q>, std::vector<Q>, std::vector<Q>>
+{
+public:
+    static std::vector<Q> calc(std::vector<Q> a, std::vector<Q> b) {
+        Cleared ca = clearDenominators(a), cb = clearDenominators(b);
+        return overDenominator(MulInteger::execute(ca.numerators, cb.numerators), ca.denominator * cb.denominator);
+    }
+};
+
+inline std::size_t digitsOf(const std::vector<Q>& coeffs) {
+    std::size_t total = 0;
+    for (const Q& c : coeffs) total += digitsOf(c.get().numerator) + c.get().denominator.get().nums.size();
+    return total;
+}
+
+inline constexpr std::size_t threshold = 16;
+// Упакованная длина не больше packing_slack объемов входа: иначе один огромный коэффициент
+// или разнобой знаменателей раздувает все слоты.
+inline constexpr std::size_t packing_slack = 8;
+
+}
+
+
+/**
+ * @brief Подстановка Кронекера для P<Q> в Poly::Mul. Выбирается вместо Карацубы, когда оба множителя
+ * не короче Kronecker::threshold, а упаковка после приведения к общему знаменателю не слишком разрежена.
+ */
+template<>
+struct Poly::TransformMul<Q> {
+    static constexpr bool available = true;
+
+    static bool preferred(const std::vector<Q>& a, const std::vector<Q>& b) {
+        return std::min(a.size(), b.size()) >= Kronecker::threshold;
+    }
+
+    static std::vector<Q> multiply(const std::vector<Q>& a, const std::vector<Q>& b) {
+        Kronecker::Cleared ca = Kronecker::clearDenominators(a), cb = Kronecker::clearDenominators(b);
+        std::size_t width = Kronecker::slotWidth(ca.numerators, cb.numerators);
+        std::size_t input = Kronecker::digitsOf(a) + Kronecker::digitsOf(b);
+        if ((a.size() + b.size()) * width > Kronecker::packing_slack * input) {
+            std::vector<Q> result(a.size() + b.size() - 1, Q::zero());
+            Poly::mulInto<Q>(a, b, result);
+            return result;
+        }
+        return Kronecker::overDenominator(Kronecker::multiplyPacked(ca.numerators, cb.numerators, width),
+                                          ca.denominator * cb.denominator);
+    }
+};
+
+#endif //KRONECKER_POLYNOM_H
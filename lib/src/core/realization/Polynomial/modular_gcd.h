@@ -0,0 +1,191 @@
+#ifndef MODULAR_GCD_POLYNOM_H
+#define MODULAR_GCD_POLYNOM_H
+
+#include <optional>
+#include <vector>
+
+#include "../Modular/crt.h"
+#include "gcd.h"
+#include "kronecker.h"
+
+/**
+ * В данном файле модулярный НОД полиномов над Q (схема Брауна - Коллинза).
+ *
+ * Алгоритм Евклида прямо над Q страдает от роста промежуточных дробей, хотя сам НОД обычно невелик.
+ * Поэтому полиномы приводятся к целым коэффициентам, НОД считается по нескольким простым модулям около 2^62
+ * (в машинных словах), нормированные образы склеиваются по CRT, а коэффициенты нормированного НОД над Q
+ * восстанавливаются как дроби. Кандидат проверяется пробным делением обоих полиномов.
+ *
+ * Простое p неудачно, если степень образа НОД больше истинной: такие образы отбрасываются, а образ меньшей
+ * степени начинает склейку заново. Простые, делящие старшие коэффициенты, пропускаются.
+ */
+
+namespace Modular {
+
+// Полином по модулю p в машинных словах, младшие степени первыми; нулевой полином - пустой вектор.
+using WordPoly = std::vector<std::uint64_t>;
+
+inline void trimWords(WordPoly& a) {
+    while (!a.empty() && a.back() == 0) a.pop_back();
+}
+
+// a mod b на месте, b ненулевой; старший коэффициент b обращается один раз.
+inline void reduceWords(WordPoly& a, const WordPoly& b, std::uint64_t p) {
+    std::uint64_t inv = invModWord(b.back(), p);
+    while (a.size() >= b.size()) {
+        std::uint64_t c = NatOper::mulModWord(a.back(), inv, p);
+        std::size_t shift = a.size() - b.size();
+        for (std::size_t j = 0; j + 1 < b.size(); ++j) {
+            std::uint64_t t = NatOper::mulModWord(c, b[j], p);
+            std::uint64_t& x = a[shift + j];
+            x = x >= t ? x - t : x + (p - t);
+        }
+        a.pop_back();
+        trimWords(a);
+    }
+}
+
+// Нормированный НОД по модулю p, хотя бы один из полиномов ненулевой.
+inline WordPoly gcdWords(WordPoly a, WordPoly b, std::uint64_t p) {
+    while (!b.empty()) {
+        reduceWords(a, b, p);
+        std::swap(a, b);
+    }
+    std::uint64_t inv = invModWord(a.back(), p);
+    for (std::uint64_t& c : a) c = NatOper::mulModWord(c, inv, p);
+    return a;
+}
+
+inline WordPoly imageOf(const std::vector<Z>& coeffs, std::uint64_t p) {
+    WordPoly image;
+    image.reserve(coeffs.size());
+    for (const Z& c : coeffs) image.push_back(c.divmodUi(p).second);   // остаток у Z неотрицательный
+    trimWords(image);
+    return image;
+}
+
+// Наибольшее простое меньше bound (bound нечетный или степень двойки).
+inline std::uint64_t primeBelow(std::uint64_t bound) {
+    for (std::uint64_t p = (bound - 2) | 1;; p -= 2) {
+        if (NatOper::isPrimeWord(p)) return p;
+    }
+}
+
+
+/**
+ * @brief Нормированный НОД полиномов над Q по модулярным образам. Ноль только у двух нулевых полиномов
+ * (исключение), НОД с нулевым полиномом - нормированный второй.
+ */
+class PolynomialGcd : public Mapping<PolynomialGcd, Polynomial<Q>, Polynomial<Q>, Polynomial<Q>>
+{
+private:
+    // Склеенные по CRT коэффициенты образов одной степени.
+    struct Images {
+        std::vector<N> residues;
+        N modulus = N::identity();
+        std::size_t count = 0;
+
+        // x' = x + M * ((r - x) * M^(-1) mod p) для каждого коэффициента.
+        void add(const WordPoly& image, std::uint64_t p) {
+            std::uint64_t inv = invModWord(modulus.divmodUi(p).second, p);
+            for (std::size_t i = 0; i < residues.size(); ++i) {
+                std::uint64_t x = residues[i].divmodUi(p).second;
+                std::uint64_t diff = image[i] >= x ? image[i] - x : image[i] + (p - x);
+                residues[i] = residues[i] + modulus.mulUi(NatOper::mulModWord(diff, inv, p));
+            }
+            modulus = modulus.mulUi(p);
+            ++count;
+        }
+
+        // Восстановление по Вангу с равными границами 10^k: 2 * 10^(2k) < M.
+        std::optional<Polynomial<Q>> reconstruct() const {
+            std::size_t digits = modulus.get().nums.size();
+            if (digits < 3) return std::nullopt;
+            Natural bound = NatOper::powerOfTen((digits - 2) / 2);
+            std::vector<Q> coeffs;
+            coeffs.reserve(residues.size());
+            for (const N& r : residues) {
+                std::optional<Rational> c = RationalReconstruction::execute(r.get(), modulus.get(), bound, bound);
+                if (!c) return std::nullopt;
+                coeffs.push_back(Q(std::move(*c)));
+            }
+            return Polynomial<Q>(coeffs);
+        }
+    };
+
+    static Polynomial<Q> monic(const Polynomial<Q>& p) {
+        Q one = Q::identity();
+        return Poly::MulScalar<Q>::execute(p, one / p.coefficients.back());
+    }
+
+    // Кандидат, построенный без p, совпадает с образом по p.
+    static bool agrees(const Polynomial<Q>& candidate, const WordPoly& image, std::uint64_t p) {
+        if (candidate.coefficients.size() != image.size()) return false;
+        for (std::size_t i = 0; i < image.size(); ++i) {
+            const Rational& c = candidate.coefficients[i].get();
+            std::uint64_t den = c.denominator.divmodUi(p).second;
+            if (den == 0 || NatOper::mulModWord(den, image[i], p) != c.numerator.divmodUi(p).second) return false;
+        }
+        return true;
+    }
+
+    static bool divides(const Polynomial<Q>& d, const Polynomial<Q>& a) {
+        return Poly::isZeroPoly(Poly::DivRem<Q>::execute(a, d).second);
+    }
+
+public:
+    static Polynomial<Q> calc(Polynomial<Q> a, Polynomial<Q> b) {
+        if (Poly::isZeroPoly(a) && Poly::isZeroPoly(b))
+            throw UniversalStringException("Polynomial: gcd of two zero polynomials is undefined");
+        if (Poly::isZeroPoly(b)) return monic(a);
+        if (Poly::isZeroPoly(a)) return monic(b);
+
+        Kronecker::Cleared ca = Kronecker::clearDenominators(a.coefficients);
+        Kronecker::Cleared cb = Kronecker::clearDenominators(b.coefficients);
+        const Z& lead_a = ca.numerators.back();
+        const Z& lead_b = cb.numerators.back();
+
+        // Степень НОД не больше меньшей из степеней; degree - наименьшая степень среди образов.
+        std::size_t degree = std::min(a.coefficients.size(), b.coefficients.size()) - 1;
+        Images images;
+        std::optional<Polynomial<Q>> candidate;
+        for (std::uint64_t p = primeBelow(std::uint64_t{1} << 62);; p = primeBelow(p)) {
+            if (lead_a.divmodUi(p).second == 0 || lead_b.divmodUi(p).second == 0) continue;
+            WordPoly g = gcdWords(imageOf(ca.numerators, p), imageOf(cb.numerators, p), p);
+            if (g.size() == 1) return Polynomial<Q>(std::vector<Q>{Q::identity()});
+            if (g.size() - 1 > degree) continue;
+            if (g.size() - 1 < degree || images.count == 0) {
+                degree = g.size() - 1;
+                images = Images{std::vector<N>(g.size(), N::zero())};
+                candidate.reset();
+            }
+
+            if (candidate) {
+                if (agrees(*candidate, g, p) && divides(*candidate, a) && divides(*candidate, b)) return *candidate;
+                candidate.reset();
+            }
+
+            // Восстановление дорогое, поэтому пробуется на 1, 2, 4, ... модулях.
+            images.add(g, p);
+            if ((images.count & (images.count - 1)) == 0) candidate = images.reconstruct();
+        }
+    }
+};
+
+}
+
+
+/**
+ * @brief НОД P<Q> через модулярные образы вместо алгоритма Евклида над дробями.
+ * Коэффициенты Безу (ExtendedGcd) по-прежнему считаются half-GCD над Q.
+ */
+template<>
+class Poly::Gcd<Q> : public BinaryOperation<Poly::Gcd<Q>, Polynomial<Q>>
+{
+public:
+    static Polynomial<Q> calc(Polynomial<Q> a, Polynomial<Q> b) {
+        return Modular::PolynomialGcd::execute(a, b);
+    }
+};
+
+#endif //MODULAR_GCD_POLYNOM_H
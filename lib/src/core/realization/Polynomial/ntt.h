@@ -0,0 +1,326 @@
+#ifndef NTT_POLYNOM_H
+#define NTT_POLYNOM_H
+
+#include <array>
+#include <bit>
+#include <span>
+#include <vector>
+
+#include "../../abstract/types/polynom.h"
+#include "../../abstract/structures/factor.h"
+#include "../deductionclass/principal_ideal_z.h"
+#include "../Natural/primality.h"
+#include "../Natural/sieve.h"
+#include "operations.h"
+
+/**
+ * В данном файле умножение полиномов над Z/pZ через теоретико-числовое преобразование (NTT) за O(n log n).
+ *
+ * Если p = c * 2^k + 1 и 2^k не меньше длины свертки, преобразование идет прямо по модулю p. Иначе свертка
+ * считается по трем NTT-простым около 2^62 и восстанавливается по CRT (Гарнер): точные коэффициенты свертки
+ * меньше n p^2 < 2^186, а произведение трех модулей больше. Таблицы корней строятся один раз на модуль.
+ */
+
+namespace Ntt {
+
+/**
+ * @brief Корни из единицы по модулю p: roots[l] - первообразный корень степени 2^l, l <= max_log.
+ */
+struct Tables {
+    std::uint64_t p;
+    unsigned max_log;
+    std::vector<std::uint64_t> roots;
+    std::vector<std::uint64_t> inv_roots;
+
+    explicit Tables(std::uint64_t p) : p(p), max_log(p > 2 ? std::countr_zero(p - 1) : 0) {
+        roots.assign(max_log + 1, 1);
+        inv_roots.assign(max_log + 1, 1);
+        if (max_log == 0) return;
+
+        // Невычет x дает корень x^((p-1)/2^k) порядка ровно 2^k; разложение p - 1 не нужно.
+        std::uint64_t x = 2;
+        while (NatOper::powModWord(x, (p - 1) / 2, p) != p - 1) ++x;
+        roots[max_log] = NatOper::powModWord(x, (p - 1) >> max_log, p);
+        inv_roots[max_log] = NatOper::powModWord(roots[max_log], p - 2, p);
+        for (unsigned l = max_log; l > 0; --l) {
+            roots[l - 1] = NatOper::mulModWord(roots[l], roots[l], p);
+            inv_roots[l - 1] = NatOper::mulModWord(inv_roots[l], inv_roots[l], p);
+        }
+    }
+};
+
+template<std::uint64_t p>
+const Tables& tablesFor() {
+    static const Tables tables(p);
+    return tables;
+}
+
+/**
+ * @brief Три NTT-простых для CRT и константы Гарнера к ним.
+ */
+struct CrtModuli {
+    std::array<Tables, 3> tables;
+    std::uint64_t inv_m1_mod_m2;
+    std::uint64_t inv_m1m2_mod_m3;
+
+    CrtModuli() : tables(make()) {
+        std::uint64_t m1 = tables[0].p, m2 = tables[1].p, m3 = tables[2].p;
+        inv_m1_mod_m2 = NatOper::powModWord(m1 % m2, m2 - 2, m2);
+        inv_m1m2_mod_m3 = NatOper::powModWord(NatOper::mulModWord(m1 % m3, m2 % m3, m3), m3 - 2, m3);
+    }
+
+private:
+    static std::array<Tables, 3> make() {
+        std::vector<std::uint64_t> primes = Primes::nttPrimes(50, 3);
+        return {Tables(primes[0]), Tables(primes[1]), Tables(primes[2])};
+    }
+};
+
+inline const CrtModuli& crtModuli() {
+    static const CrtModuli moduli;
+    return moduli;
+}
+
+
+// (u + v) mod p и (u - v) mod p для u, v < p: p может быть больше 2^63, поэтому u + v нельзя считать в слове.
+inline std::uint64_t addMod(std::uint64_t u, std::uint64_t v, std::uint64_t p) {
+    return u >= p - v ? u - (p - v) : u + v;
+}
+
+inline std::uint64_t subMod(std::uint64_t u, std::uint64_t v, std::uint64_t p) {
+    return u >= v ? u - v : p - (v - u);
+}
+
+
+/**
+ * @brief Преобразование на месте, длина - степень двойки не больше 2^max_log.
+ */
+inline void transform(std::vector<std::uint64_t>& a, const Tables& t, bool inverse) {
+    std::size_t size = a.size();
+    std::uint64_t p = t.p;
+    for (std::size_t i = 1, j = 0; i < size; ++i) {
+        std::size_t bit = size >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(a[i], a[j]);
+    }
+
+    for (std::size_t len = 2, level = 1; len <= size; len <<= 1, ++level) {
+        std::uint64_t step = inverse ? t.inv_roots[level] : t.roots[level];
+        std::size_t half = len / 2;
+        std::vector<std::uint64_t> twiddles(half);
+        twiddles[0] = 1;
+        for (std::size_t j = 1; j < half; ++j) twiddles[j] = NatOper::mulModWord(twiddles[j - 1], step, p);
+
+        for (std::size_t i = 0; i < size; i += len) {
+            for (std::size_t j = 0; j < half; ++j) {
+                std::uint64_t u = a[i + j];
+                std::uint64_t v = NatOper::mulModWord(a[i + j + half], twiddles[j], p);
+                a[i + j] = addMod(u, v, p);
+                a[i + j + half] = subMod(u, v, p);
+            }
+        }
+    }
+
+    if (inverse) {
+        std::uint64_t inv_size = NatOper::powModWord(size % p, p - 2, p);
+        for (std::uint64_t& x : a) x = NatOper::mulModWord(x, inv_size, p);
+    }
+}
+
+// Образ вектора длины size (степень двойки) по модулю t.p.
+inline std::vector<std::uint64_t> forward(std::span<const std::uint64_t> a, std::size_t size, const Tables& t) {
+    std::vector<std::uint64_t> image(size, 0);
+    for (std::size_t i = 0; i < a.size(); ++i) image[i % size] = addMod(image[i % size], a[i] % t.p, t.p);
+    transform(image, t, false);
+    return image;
+}
+
+inline std::vector<std::uint64_t> pointwiseBack(std::vector<std::uint64_t> fa, const std::vector<std::uint64_t>& fb,
+                                                const Tables& t) {
+    for (std::size_t i = 0; i < fa.size(); ++i) fa[i] = NatOper::mulModWord(fa[i], fb[i], t.p);
+    transform(fa, t, true);
+    return fa;
+}
+
+// Остаток по p числа, заданного вычетами по трем модулям CRT.
+inline std::uint64_t garner(std::uint64_t r1, std::uint64_t r2, std::uint64_t r3, std::uint64_t p) {
+    const CrtModuli& crt = crtModuli();
+    std::uint64_t m1 = crt.tables[0].p, m2 = crt.tables[1].p, m3 = crt.tables[2].p;
+    std::uint64_t t2 = NatOper::mulModWord((r2 + m2 - r1 % m2) % m2, crt.inv_m1_mod_m2, m2);
+    std::uint64_t x12 = (r1 % m3 + NatOper::mulModWord(m1 % m3, t2, m3)) % m3;
+    std::uint64_t t3 = NatOper::mulModWord((r3 + m3 - x12) % m3, crt.inv_m1m2_mod_m3, m3);
+
+    std::uint64_t result = r1 % p;
+    result = addMod(result, NatOper::mulModWord(m1 % p, t2, p), p);
+    std::uint64_t m1m2 = NatOper::mulModWord(m1 % p, m2 % p, p);
+    return addMod(result, NatOper::mulModWord(m1m2, t3, p), p);
+}
+
+
+/**
+ * @brief Образ фиксированного множителя: по модулю p или по трем модулям CRT.
+ * Хранится, чтобы повторные умножения на тот же полином не пересчитывали его преобразование.
+ */
+struct Image {
+    std::size_t size = 0;
+    std::vector<std::vector<std::uint64_t>> parts;
+};
+
+inline bool direct(std::size_t size, const Tables& own) {
+    return (std::size_t{1} << own.max_log) >= size && own.max_log < 64;
+}
+
+inline Image imageOf(std::span<const std::uint64_t> a, std::size_t size, const Tables& own) {
+    Image image;
+    image.size = size;
+    if (direct(size, own)) {
+        image.parts.push_back(forward(a, size, own));
+    } else {
+        for (const Tables& t : crtModuli().tables) image.parts.push_back(forward(a, size, t));
+    }
+    return image;
+}
+
+/**
+ * @brief Циклическая свертка длины image.size по модулю own.p: коэффициенты с индексами >= size
+ * складываются с индексами по модулю size.
+ */
+inline std::vector<std::uint64_t> cyclic(std::span<const std::uint64_t> a, const Image& b, const Tables& own) {
+    if (direct(b.size, own)) return pointwiseBack(forward(a, b.size, own), b.parts[0], own);
+
+    const CrtModuli& crt = crtModuli();
+    std::array<std::vector<std::uint64_t>, 3> residues;
+    for (std::size_t k = 0; k < 3; ++k)
+        residues[k] = pointwiseBack(forward(a, b.size, crt.tables[k]), b.parts[k], crt.tables[k]);
+
+    std::vector<std::uint64_t> result(b.size);
+    for (std::size_t i = 0; i < b.size; ++i) result[i] = garner(residues[0][i], residues[1][i], residues[2][i], own.p);
+    return result;
+}
+
+inline std::size_t transformSize(std::size_t length) {
+    return std::bit_ceil(std::max<std::size_t>(length, 1));
+}
+
+
+template<size_t p>
+using Field = FactorField<Z, PrincipalIdealZ<p>>;
+
+template<size_t p>
+std::vector<std::uint64_t> toWords(const std::vector<Field<p>>& coeffs) {
+    std::vector<std::uint64_t> words;
+    words.reserve(coeffs.size());
+    for (const Field<p>& c : coeffs) words.push_back(c.get().toUInt64());
+    return words;
+}
+
+template<size_t p>
+std::vector<Field<p>> fromWords(std::span<const std::uint64_t> words) {
+    std::vector<Field<p>> coeffs;
+    coeffs.reserve(words.size());
+    for (std::uint64_t w : words) coeffs.push_back(Field<p>(Z(N(w))));
+    if (coeffs.empty()) coeffs.push_back(Field<p>::zero());
+    return coeffs;
+}
+
+template<size_t p>
+std::vector<std::uint64_t> multiplyWords(std::span<const std::uint64_t> a, std::span<const std::uint64_t> b) {
+    std::size_t length = a.size() + b.size() - 1;
+    std::vector<std::uint64_t> result = cyclic(a, imageOf(b, transformSize(length), tablesFor<p>()), tablesFor<p>());
+    result.resize(length);
+    return result;
+}
+
+
+/**
+ * @brief Младшие n коэффициентов произведения (a * b mod x^n).
+ */
+template<size_t p>
+class MulLow : public Mapping<MulLow<p>, Polynomial<Field<p>>, Polynomial<Field<p>>, Polynomial<Field<p>>, std::size_t>
+{
+public:
+    static Polynomial<Field<p>> calc(Polynomial<Field<p>> a, Polynomial<Field<p>> b, std::size_t n) {
+        if (n == 0) return Polynomial<Field<p>>({Field<p>::zero()});
+        std::vector<std::uint64_t> wa = toWords<p>(a.coefficients), wb = toWords<p>(b.coefficients);
+        wa.resize(std::min(wa.size(), n));
+        wb.resize(std::min(wb.size(), n));
+        std::vector<std::uint64_t> product = multiplyWords<p>(wa, wb);
+        product.resize(std::min(product.size(), n));
+        return Polynomial<Field<p>>(fromWords<p>(product));
+    }
+};
+
+/**
+ * @brief Средняя часть произведения: a длины n + m - 1 и b длины m - коэффициенты с m - 1 по n + m - 2.
+ * Хватает циклической свертки длины n + m - 1: переносы попадают только в младшие m - 1 разрядов.
+ * Длины передаются явно: Polynomial отрезает старшие нули, и по coefficients.size() их не восстановить.
+ */
+template<size_t p>
+class MulMiddle : public Mapping<MulMiddle<p>, Polynomial<Field<p>>, Polynomial<Field<p>>, Polynomial<Field<p>>,
+                                 std::size_t, std::size_t>
+{
+public:
+    static Polynomial<Field<p>> calc(Polynomial<Field<p>> a, Polynomial<Field<p>> b, std::size_t m, std::size_t n) {
+        std::vector<std::uint64_t> wa = toWords<p>(a.coefficients), wb = toWords<p>(b.coefficients);
+        if (m == 0 || n == 0 || wb.size() > m || wa.size() > n + m - 1)
+            throw UniversalStringException("Ntt: middle product needs len(b) <= m and len(a) <= n + m - 1");
+        wa.resize(n + m - 1, 0);
+        std::vector<std::uint64_t> cycle = cyclic(wa, imageOf(wb, transformSize(wa.size()), tablesFor<p>()), tablesFor<p>());
+        return Polynomial<Field<p>>(fromWords<p>(std::span<const std::uint64_t>(cycle).subspan(m - 1, n)));
+    }
+};
+
+
+/**
+ * @brief Умножение на фиксированный полином: его образ пересчитывается, только когда нужна большая длина.
+ *
+ * @code
+ * Ntt::FixedMultiplier<p> by_f(f);
+ * for (auto& g : polys) g = by_f.multiply(g);
+ * @endcode
+ */
+template<size_t p>
+class FixedMultiplier {
+private:
+    std::vector<std::uint64_t> operand;
+    Image image;
+
+public:
+    explicit FixedMultiplier(const Polynomial<Field<p>>& poly) : operand(toWords<p>(poly.coefficients)) {}
+
+    Polynomial<Field<p>> multiply(const Polynomial<Field<p>>& other) {
+        std::vector<std::uint64_t> words = toWords<p>(other.coefficients);
+        std::size_t length = words.size() + operand.size() - 1;
+        std::size_t size = transformSize(length);
+        if (image.size != size) image = imageOf(operand, size, tablesFor<p>());
+        std::vector<std::uint64_t> result = cyclic(words, image, tablesFor<p>());
+        result.resize(length);
+        return Polynomial<Field<p>>(fromWords<p>(result));
+    }
+};
+
+}
+
+
+/**
+ * @brief NTT для P<Zp<p>> в Poly::Mul.
+ */
+template<size_t p>
+struct Poly::TransformMul<FactorField<Z, PrincipalIdealZ<p>>> {
+    using T = FactorField<Z, PrincipalIdealZ<p>>;
+
+    static constexpr bool available = true;
+    static constexpr size_t threshold = 32;
+
+    static bool preferred(const std::vector<T>& a, const std::vector<T>& b) {
+        return std::min(a.size(), b.size()) >= threshold;
+    }
+
+    static std::vector<T> multiply(const std::vector<T>& a, const std::vector<T>& b) {
+        std::vector<std::uint64_t> product = Ntt::multiplyWords<p>(Ntt::toWords<p>(a), Ntt::toWords<p>(b));
+        return Ntt::fromWords<p>(product);
+    }
+};
+
+#endif //NTT_POLYNOM_H
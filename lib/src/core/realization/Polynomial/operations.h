@@ -2,6 +2,12 @@
 #define OPERATIONS_POLYNOM_H
 
 
+#include <cstdint>
+#include <algorithm>
+#include <span>
+#include <string>
+#include <utility>
+
 #include "../../abstract/types/polynom.h"
 
 #include "../../abstract/transformations/operations/unary.h"
@@ -9,6 +15,8 @@
 
 #include "Exceptions/UniversalStringException.h"
 
+class Q;
+
 namespace Poly {
 
 /**
@@ -127,7 +135,90 @@ public:
 
 
 /**
- * @brief Умножение полиномов
+ * @brief Порог перехода с умножения столбиком на Карацубу (по длине меньшего множителя).
+ * Карацуба меняет одно умножение коэффициентов на несколько сложений, поэтому для Q, где сложение
+ * не дешевле умножения, порог выше.
+ */
+template<typename T>
+struct KaratsubaThreshold {
+    static constexpr size_t value = 32;
+};
+
+template<>
+struct KaratsubaThreshold<::Q> {
+    static constexpr size_t value = 48;
+};
+
+
+/**
+ * @brief out += a * b, out.size() == a.size() + b.size() - 1.
+ * Деление пополам идет по участкам исходных векторов, промежуточные полиномы не строятся:
+ * a = a0 + x^k a1, b = b0 + x^k b1, a * b = z0 + x^k ((a0 + a1)(b0 + b1) - z0 - z2) + x^2k z2.
+ */
+template<typename T>
+void mulInto(std::span<const T> a, std::span<const T> b, std::span<T> out) {
+    if (a.size() < b.size()) std::swap(a, b);
+    size_t n = a.size();
+    size_t m = b.size();
+    T zero = T::zero();
+
+    if (m < KaratsubaThreshold<T>::value) {
+        for (size_t i = 0; i < n; ++i) {
+            if (a[i] == zero) continue;
+            for (size_t j = 0; j < m; ++j) out[i + j] = out[i + j] + a[i] * b[j];
+        }
+        return;
+    }
+
+    size_t k = (n + 1) / 2;
+    if (m <= k) {
+        // Множители разной длины: длинный режем на куски длины m.
+        for (size_t i = 0; i < n; i += m) {
+            size_t len = std::min(m, n - i);
+            mulInto(a.subspan(i, len), b, out.subspan(i, len + m - 1));
+        }
+        return;
+    }
+
+    std::span<const T> a0 = a.first(k), a1 = a.subspan(k);
+    std::span<const T> b0 = b.first(k), b1 = b.subspan(k);
+
+    std::vector<T> z0(2 * k - 1, zero);
+    mulInto(a0, b0, std::span<T>(z0));
+    std::vector<T> z2(a1.size() + b1.size() - 1, zero);
+    mulInto(a1, b1, std::span<T>(z2));
+
+    std::vector<T> sa(a0.begin(), a0.end());
+    for (size_t i = 0; i < a1.size(); ++i) sa[i] = sa[i] + a1[i];
+    std::vector<T> sb(b0.begin(), b0.end());
+    for (size_t i = 0; i < b1.size(); ++i) sb[i] = sb[i] + b1[i];
+
+    std::vector<T> z1(2 * k - 1, zero);
+    mulInto(std::span<const T>(sa), std::span<const T>(sb), std::span<T>(z1));
+    for (size_t i = 0; i < z0.size(); ++i) z1[i] = z1[i] - z0[i];
+    for (size_t i = 0; i < z2.size(); ++i) z1[i] = z1[i] - z2[i];
+
+    for (size_t i = 0; i < z0.size(); ++i) out[i] = out[i] + z0[i];
+    // Старшие разряды z1 за пределами out равны нулю.
+    for (size_t i = 0; i < z1.size() && i + k < out.size(); ++i) out[i + k] = out[i + k] + z1[i];
+    for (size_t i = 0; i < z2.size(); ++i) out[i + 2 * k] = out[i + 2 * k] + z2[i];
+}
+
+
+/**
+ * @brief Точка расширения для умножения через преобразование (NTT, подстановка Кронекера). Специализация
+ * задает available = true и статические preferred(a, b) -> bool (выбор против Карацубы) и
+ * multiply(a, b) -> std::vector<T> над векторами коэффициентов.
+ */
+template<typename T>
+struct TransformMul {
+    static constexpr bool available = false;
+};
+
+
+/**
+ * @brief Умножение полиномов: столбиком для коротких множителей, Карацуба для длинных,
+ * преобразование для самых длинных, если оно есть для T (см. TransformMul).
  */
 template<typename T>
 requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
@@ -151,45 +242,115 @@ public:
         
         std::vector<T> result;
         try {
+            if constexpr (TransformMul<T>::available) {
+                if (TransformMul<T>::preferred(p1.coefficients, p2.coefficients)) {
+                    return Polynomial<T>(TransformMul<T>::multiply(p1.coefficients, p2.coefficients));
+                }
+            }
             result.assign(n + m - 1, zero);
+            mulInto(std::span<const T>(p1.coefficients), std::span<const T>(p2.coefficients), std::span<T>(result));
         } catch (const std::bad_alloc&) {
             throw UniversalStringException("Polynomial: not enough memory for multiplication");
         }
         
-
-        for (size_t i = 0; i < n; ++i) {
-            if (p1.coefficients[i] == zero) continue;
-            
-            for (size_t j = 0; j < m; ++j) {
-                if (p2.coefficients[j] == zero) continue;
-                
-                result[i + j] = result[i + j] + (p1.coefficients[i] * p2.coefficients[j]);
-            }
-        }
-        
         // Удаляем ведущие нули
         while (result.size() > 1 && result.back() == zero) {
             result.pop_back();
         }
         
-        if (result.empty()) {
-            result.push_back(zero);
-        }
-        
         return Polynomial<T>(result);
     }
 };
 
 
+// Младшие n коэффициентов (a mod x^n), без ведущих нулей.
+template<typename T>
+Polynomial<T> truncated(const std::vector<T>& coeffs, size_t n) {
+    std::vector<T> low(coeffs.begin(), coeffs.begin() + std::min(n, coeffs.size()));
+    if (low.empty()) low.push_back(T::zero());
+    return Polynomial<T>(low);
+}
+
+// Коэффициенты в обратном порядке: x^(size-1) a(1/x), дополненные нулями до size.
+template<typename T>
+std::vector<T> reversed(const std::vector<T>& coeffs, size_t size) {
+    std::vector<T> rev(size, T::zero());
+    for (size_t i = 0; i < std::min(size, coeffs.size()); ++i) rev[size - 1 - i] = coeffs[i];
+    return rev;
+}
+
+
 /**
- * @brief Деление полиномов (возвращает частное)
+ * @brief Обратный степенной ряд: g с f g = 1 mod x^n, нужно f(0) != 0.
+ * Итерация Ньютона g <- g (2 - f g) удваивает число верных коэффициентов, итого O(M(n)).
  */
 template<typename T>
 requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
-class Div : public BinaryOperation<Div<T>, Polynomial<T>>
+class InverseSeries : public Mapping<InverseSeries<T>, Polynomial<T>, Polynomial<T>, size_t>
 {
 public:
-    static Polynomial<T> calc(Polynomial<T> dividend, Polynomial<T> divisor) {
+    static Polynomial<T> calc(Polynomial<T> f, size_t n) {
+        T zero = T::zero();
+        if (f.coefficients[0] == zero)
+            throw UniversalStringException("Polynomial: series with zero constant term is not invertible");
+
+        T one = T::identity();
+        Polynomial<T> g(std::vector<T>{one / f.coefficients[0]});
+        for (size_t k = 1; k < n;) {
+            k = std::min(2 * k, n);
+            Polynomial<T> fg = truncated(Mul<T>::execute(truncated(f.coefficients, k), g).coefficients, k);
+            std::vector<T> correction(fg.coefficients.size(), zero);
+            for (size_t i = 0; i < correction.size(); ++i) correction[i] = zero - fg.coefficients[i];
+            correction[0] = correction[0] + one + one;
+            g = truncated(Mul<T>::execute(g, Polynomial<T>(correction)).coefficients, k);
+        }
+        return g;
+    }
+};
+
+
+// С какой длины частного и делителя деление через обратный ряд быстрее деления уголком.
+inline constexpr size_t newton_division_threshold = 64;
+
+/**
+ * @brief Частное через обратный ряд перевернутого делителя: rev(q) = rev(a) rev(b)^(-1) mod x^k,
+ * где k = deg a - deg b + 1. inv_rev_divisor должен быть верен хотя бы до x^k.
+ */
+template<typename T>
+Polynomial<T> quotientByInverse(const Polynomial<T>& dividend, const Polynomial<T>& inv_rev_divisor, size_t divisor_size) {
+    size_t k = dividend.coefficients.size() - divisor_size + 1;
+    std::vector<T> rev_a = reversed(dividend.coefficients, dividend.coefficients.size());
+    Polynomial<T> rev_q = truncated(Mul<T>::execute(truncated(rev_a, k), truncated(inv_rev_divisor.coefficients, k)).coefficients, k);
+    return Polynomial<T>(reversed(rev_q.coefficients, k));
+}
+
+// Остаток a - q b: нужны только младшие deg b коэффициентов.
+template<typename T>
+Polynomial<T> remainderOf(const Polynomial<T>& dividend, const Polynomial<T>& divisor, const Polynomial<T>& quotient) {
+    size_t r_size = divisor.coefficients.size() - 1;
+    if (r_size == 0) return Polynomial<T>({T::zero()});
+    Polynomial<T> qb = Mul<T>::execute(truncated(quotient.coefficients, r_size), truncated(divisor.coefficients, r_size));
+    T zero = T::zero();
+    std::vector<T> r(r_size, zero);
+    for (size_t i = 0; i < r_size; ++i) {
+        T a = i < dividend.coefficients.size() ? dividend.coefficients[i] : zero;
+        T b = i < qb.coefficients.size() ? qb.coefficients[i] : zero;
+        r[i] = a - b;
+    }
+    return Polynomial<T>(r);
+}
+
+
+/**
+ * @brief Деление с остатком. Уголком для коротких частного или делителя (остаток выходит сразу),
+ * через обратный ряд перевернутого делителя для длинных - за O(M(n)) вместо O(n m).
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class DivRem : public Mapping<DivRem<T>, std::pair<Polynomial<T>, Polynomial<T>>, Polynomial<T>, Polynomial<T>>
+{
+public:
+    static std::pair<Polynomial<T>, Polynomial<T>> calc(Polynomial<T> dividend, Polynomial<T> divisor) {
         T zero = T::zero();
         
         if (divisor.coefficients.back() == zero)
@@ -199,12 +360,23 @@ public:
         size_t dividend_size = dividend.coefficients.size();
         
         if (dividend_size < divisor_size)
-            return Polynomial<T>({zero});
+            return {Polynomial<T>({zero}), dividend};
+
+        size_t quotient_size = dividend_size - divisor_size + 1;
+        if (std::min(quotient_size, divisor_size) >= newton_division_threshold) {
+            Polynomial<T> inverse = InverseSeries<T>::execute(Polynomial<T>(reversed(divisor.coefficients, divisor_size)),
+                                                              quotient_size);
+            Polynomial<T> quotient = quotientByInverse(dividend, inverse, divisor_size);
+            Polynomial<T> remainder = remainderOf(dividend, divisor, quotient);
+            return {std::move(quotient), std::move(remainder)};
+        }
         
         std::vector<T> remainder = dividend.coefficients;
-        std::vector<T> quotient(dividend_size - divisor_size + 1, zero);
+        std::vector<T> quotient(quotient_size, zero);
         
-        const T& divisor_leading = divisor.coefficients.back();
+        // Обратный к старшему коэффициенту один на все деление: деление в поле дороже умножения.
+        T one = T::identity();
+        T inv_leading = one / divisor.coefficients.back();
         
         // Деление "уголком"
         for (size_t pos = dividend_size; pos >= divisor_size; --pos) {
@@ -213,24 +385,32 @@ public:
             if (remainder[pos - 1] == zero)
                 continue;
             
-            T coeff = remainder[pos - 1] / divisor_leading;
+            T coeff = remainder[pos - 1] * inv_leading;
             quotient[quotient_idx] = coeff;
             
             for (size_t j = 0; j < divisor_size; ++j) {
                 remainder[quotient_idx + j] = remainder[quotient_idx + j] - (divisor.coefficients[j] * coeff);
             }
         }
+
+        remainder.erase(remainder.begin() + (divisor_size - 1), remainder.end());
+        if (remainder.empty()) remainder.push_back(zero);
         
-        // Удаляем ведущие нули
-        while (quotient.size() > 1 && quotient.back() == zero) {
-            quotient.pop_back();
-        }
-        
-        if (quotient.empty()) {
-            quotient.push_back(zero);
-        }
-        
-        return Polynomial<T>(quotient);
+        return {Polynomial<T>(quotient), Polynomial<T>(remainder)};
+    }
+};
+
+
+/**
+ * @brief Деление полиномов (возвращает частное)
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class Div : public BinaryOperation<Div<T>, Polynomial<T>>
+{
+public:
+    static Polynomial<T> calc(Polynomial<T> dividend, Polynomial<T> divisor) {
+        return DivRem<T>::execute(dividend, divisor).first;
     }
 };
 
@@ -244,12 +424,75 @@ class Rem : public BinaryOperation<Rem<T>, Polynomial<T>>
 {
 public:
     static Polynomial<T> calc(Polynomial<T> dividend, Polynomial<T> divisor) {
-        Polynomial<T> quotient = Div<T>::execute(dividend, divisor);
-        Polynomial<T> product = Mul<T>::execute(quotient, divisor);
-        return Sub<T>::execute(dividend, product);
+        return DivRem<T>::execute(dividend, divisor).second;
+    }
+};
+
+
+/**
+ * @brief Деление на фиксированный полином с запомненным обратным рядом его переворота.
+ * Для многократной редукции по одному модулю (кольцо вычетов по полиному, модульная композиция):
+ * ряд считается один раз и дорастает по мере надобности, дальше каждое деление - два умножения.
+ *
+ * @code
+ * Poly::Reducer<T> mod_f(f);
+ * Polynomial<T> r = mod_f.rem(Poly::Mul<T>::execute(a, b));
+ * @endcode
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class Reducer {
+private:
+    Polynomial<T> modulus;
+    Polynomial<T> rev_modulus;
+    Polynomial<T> inverse;
+    size_t precision = 0;
+
+public:
+    explicit Reducer(Polynomial<T> f) : modulus(std::move(f)),
+                                        rev_modulus(reversed(modulus.coefficients, modulus.coefficients.size())),
+                                        inverse({T::zero()}) {
+        if (modulus.coefficients.back() == T::zero())
+            throw UniversalStringException("Polynomial: cannot divide by zero polynomial");
+    }
+
+    std::pair<Polynomial<T>, Polynomial<T>> divRem(const Polynomial<T>& dividend) {
+        size_t divisor_size = modulus.coefficients.size();
+        if (dividend.coefficients.size() < divisor_size)
+            return {Polynomial<T>({T::zero()}), dividend};
+
+        size_t quotient_size = dividend.coefficients.size() - divisor_size + 1;
+        if (quotient_size > precision) {
+            precision = std::max(quotient_size, 2 * precision);
+            inverse = InverseSeries<T>::execute(rev_modulus, precision);
+        }
+        Polynomial<T> quotient = quotientByInverse(dividend, inverse, divisor_size);
+        Polynomial<T> remainder = remainderOf(dividend, modulus, quotient);
+        return {std::move(quotient), std::move(remainder)};
     }
+
+    Polynomial<T> rem(const Polynomial<T>& dividend) { return divRem(dividend).second; }
+
+    const Polynomial<T>& get() const { return modulus; }
 };
 
+
+// i * coeff: если у поля есть умножение на машинное слово - берем его, иначе удвоение-сложение за O(log i).
+template<typename T>
+T mulByIndex(const T& coeff, std::uint64_t i) {
+    if constexpr (requires(const T& c, std::uint64_t k) { { c.mulUi(k) } -> std::convertible_to<T>; }) {
+        return coeff.mulUi(i);
+    } else {
+        T result = T::zero();
+        T addend = coeff;
+        for (; i > 0; i >>= 1) {
+            if (i & 1) result = result + addend;
+            addend = addend + addend;
+        }
+        return result;
+    }
+}
+
 template<typename T>
 class Derivative : public UnaryOperation<Derivative<T>, Polynomial<T>>
 {
@@ -264,18 +507,65 @@ public:
         result.reserve(poly.coefficients.size() - 1);
         
         for (size_t i = 1; i < poly.coefficients.size(); ++i) {
-            // i * coefficients[i] = coefficients[i] + ... + coefficients[i] (i раз)
-            T coeff = poly.coefficients[i];
-            for (size_t k = 1; k < i; ++k) {
-                coeff = coeff + poly.coefficients[i];
-            }
-            result.push_back(coeff);
+            result.push_back(mulByIndex(poly.coefficients[i], i));
         }
         
         return Polynomial<T>(result);
     }
 };
 
+/**
+ * @brief Значение полинома в точке по схеме Горнера.
+ */
+template<typename T>
+class Evaluate : public Mapping<Evaluate<T>, T, Polynomial<T>, T>
+{
+public:
+    static T calc(Polynomial<T> poly, T x) {
+        T result = poly.coefficients.back();
+        for (size_t i = poly.coefficients.size() - 1; i-- > 0;) {
+            result = result * x + poly.coefficients[i];
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Дописывает к строке член coeff * x^exponent; first - член стоит первым (старшим).
+ * Общая запись членов для плотных и разреженных полиномов.
+ */
+template<typename T>
+void appendTerm(std::string& result, const T& coeff, std::uint64_t exponent, bool first) {
+    T zero = T::zero();
+
+    if (!first) {
+        result += " ";
+        result += coeff.isNegative() ? "- " : "+ ";
+    } else if (coeff.isNegative()) {
+        result += "-";
+    }
+
+    std::string coeff_str = coeff.toString();
+    if (coeff.isNegative() && coeff_str[0] == '-') {
+        coeff_str = coeff_str.substr(1);
+    }
+
+    T abs_coeff = coeff.isNegative() ? (zero - coeff) : coeff;
+    if (!(abs_coeff == T::identity() && exponent > 0)) {
+        result += coeff_str;
+    }
+
+    if (exponent > 0) {
+        if (!(abs_coeff == T::identity())) {
+            result += "*";
+        }
+        result += "x";
+        if (exponent > 1) {
+            result += "^" + std::to_string(exponent);
+        }
+    }
+}
+
 /**
  * @brief Преобразование полинома в строку
  */
@@ -297,32 +587,7 @@ public:
                 continue;
             }
             
-            if (i != static_cast<int>(poly.coefficients.size()) - 1) {
-                result += " ";
-                result += coeff.isNegative() ? "- " : "+ ";
-            } else if (coeff.isNegative()) {
-                result += "-";
-            }
-            
-            std::string coeff_str = coeff.toString();
-            if (coeff.isNegative() && coeff_str[0] == '-') {
-                coeff_str = coeff_str.substr(1); 
-            }
-            
-            T abs_coeff = coeff.isNegative() ? (zero - coeff) : coeff;
-            if (!(abs_coeff == T::identity() && i > 0)) {
-                result += coeff_str;
-            }
-            
-            if (i > 0) {
-                if (!(abs_coeff == T::identity())) {
-                    result += "*";
-                }
-                result += "x";
-                if (i > 1) {
-                    result += "^" + std::to_string(i);
-                }
-            }
+            appendTerm(result, coeff, static_cast<std::uint64_t>(i), i == static_cast<int>(poly.coefficients.size()) - 1);
         }
         
         return result.empty() ? "0" : result;
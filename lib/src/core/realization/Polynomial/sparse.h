@@ -0,0 +1,363 @@
+#ifndef SPARSE_OPERATIONS_POLYNOM_H
+#define SPARSE_OPERATIONS_POLYNOM_H
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../abstract/types/sparse_polynom.h"
+#include "operations.h"
+
+/**
+ * В данном файле операции над разреженными полиномами (см. SparsePolynomial): память и время зависят от
+ * числа ненулевых членов, а не от степени.
+ *
+ * Произведение считается кучей (Джонсон, Монаган - Пирс): члены a_i b_j выходят из кучи по возрастанию
+ * степени, одинаковые степени сразу складываются, поэтому промежуточных полиномов нет, а куча держит не
+ * больше одного кандидата на член a. Если оба полинома на деле плотные (см. dense_ratio), умножение и деление
+ * переводятся в плотное представление, где работают Карацуба, NTT и деление через обратный ряд.
+ */
+
+namespace Sparse {
+
+// Полином считается плотным, если ненулевых членов не меньше (степень + 1) / dense_ratio.
+inline constexpr std::uint64_t dense_ratio = 4;
+
+template<typename T>
+bool isDense(const SparsePolynomial<T>& p) {
+    return !p.isZero() && p.degree() / dense_ratio < p.terms.size();
+}
+
+
+/**
+ * @brief Разреженная запись плотного полинома.
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class FromDense : public Mapping<FromDense<T>, SparsePolynomial<T>, Polynomial<T>>
+{
+public:
+    static SparsePolynomial<T> calc(Polynomial<T> poly) {
+        T zero = T::zero();
+        SparsePolynomial<T> result;
+        for (std::size_t i = 0; i < poly.coefficients.size(); ++i) {
+            if (!(poly.coefficients[i] == zero)) result.terms.push_back({static_cast<std::uint64_t>(i), std::move(poly.coefficients[i])});
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Плотная запись: вектор из degree + 1 коэффициентов.
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class ToDense : public Mapping<ToDense<T>, Polynomial<T>, SparsePolynomial<T>>
+{
+public:
+    static Polynomial<T> calc(SparsePolynomial<T> poly) {
+        T zero = T::zero();
+        std::vector<T> coeffs;
+        try {
+            coeffs.assign(poly.degree() + 1, zero);
+        } catch (const std::bad_alloc&) {
+            throw UniversalStringException("SparsePolynomial: degree is too large for a dense polynomial");
+        }
+        for (SparseTerm<T>& term : poly.terms) coeffs[term.exponent] = std::move(term.coefficient);
+        return Polynomial<T>(coeffs);
+    }
+};
+
+
+// Слияние двух списков членов: a + b или a - b.
+template<typename T, bool subtract>
+SparsePolynomial<T> merge(const SparsePolynomial<T>& a, const SparsePolynomial<T>& b) {
+    T zero = T::zero();
+    SparsePolynomial<T> result;
+    result.terms.reserve(a.terms.size() + b.terms.size());
+    auto negated = [&zero](const T& c) -> T {
+        if constexpr (subtract) return zero - c;
+        else return c;
+    };
+
+    std::size_t i = 0, j = 0;
+    while (i < a.terms.size() || j < b.terms.size()) {
+        if (j == b.terms.size() || (i < a.terms.size() && a.terms[i].exponent < b.terms[j].exponent)) {
+            result.terms.push_back(a.terms[i++]);
+        } else if (i == a.terms.size() || b.terms[j].exponent < a.terms[i].exponent) {
+            result.terms.push_back({b.terms[j].exponent, negated(b.terms[j].coefficient)});
+            ++j;
+        } else {
+            T sum = a.terms[i].coefficient + negated(b.terms[j].coefficient);
+            if (!(sum == zero)) result.terms.push_back({a.terms[i].exponent, std::move(sum)});
+            ++i;
+            ++j;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Сложение разреженных полиномов
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class Add : public BinaryOperation<Add<T>, SparsePolynomial<T>>,
+            public Associative,
+            public Commutative,
+            public Identity,
+            public Inverse
+{
+public:
+    static SparsePolynomial<T> calc(SparsePolynomial<T> p1, SparsePolynomial<T> p2) {
+        return merge<T, false>(p1, p2);
+    }
+};
+
+/**
+ * @brief Вычитание разреженных полиномов
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class Sub : public BinaryOperation<Sub<T>, SparsePolynomial<T>>
+{
+public:
+    static SparsePolynomial<T> calc(SparsePolynomial<T> p1, SparsePolynomial<T> p2) {
+        return merge<T, true>(p1, p2);
+    }
+};
+
+/**
+ * @brief Умножение разреженного полинома на скаляр
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class MulScalar : public Mapping<MulScalar<T>, SparsePolynomial<T>, SparsePolynomial<T>, T>
+{
+public:
+    static SparsePolynomial<T> calc(SparsePolynomial<T> poly, T scalar) {
+        T zero = T::zero();
+        if (scalar == zero) return SparsePolynomial<T>();
+        for (SparseTerm<T>& term : poly.terms) term.coefficient = term.coefficient * scalar;
+        return poly;
+    }
+};
+
+
+/**
+ * @brief Произведение кучей. Кандидат (i, j) - член a_i b_j; после (i, j) в кучу идет (i, j + 1),
+ * а после (i, 0) еще и (i + 1, 0), так что куча растет только по мере надобности.
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class Mul : public BinaryOperation<Mul<T>, SparsePolynomial<T>>,
+            public Associative,
+            public Commutative,
+            public Identity
+{
+private:
+    struct Candidate {
+        std::uint64_t exponent;
+        std::size_t i;
+        std::size_t j;
+
+        bool operator>(const Candidate& other) const { return exponent > other.exponent; }
+    };
+
+public:
+    static SparsePolynomial<T> calc(SparsePolynomial<T> p1, SparsePolynomial<T> p2) {
+        if (p1.isZero() || p2.isZero()) return SparsePolynomial<T>();
+        if (p1.degree() > std::numeric_limits<std::uint64_t>::max() - p2.degree())
+            throw UniversalStringException("SparsePolynomial: exponent overflow in multiplication");
+
+        if (isDense(p1) && isDense(p2))
+            return FromDense<T>::execute(Poly::Mul<T>::execute(ToDense<T>::execute(p1), ToDense<T>::execute(p2)));
+
+        // Внешний цикл по более короткому множителю: куча не длиннее него.
+        const std::vector<SparseTerm<T>>& a = p1.terms.size() <= p2.terms.size() ? p1.terms : p2.terms;
+        const std::vector<SparseTerm<T>>& b = p1.terms.size() <= p2.terms.size() ? p2.terms : p1.terms;
+
+        T zero = T::zero();
+        SparsePolynomial<T> result;
+        std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> heap;
+        heap.push({a[0].exponent + b[0].exponent, 0, 0});
+        while (!heap.empty()) {
+            std::uint64_t exponent = heap.top().exponent;
+            T sum = zero;
+            while (!heap.empty() && heap.top().exponent == exponent) {
+                Candidate top = heap.top();
+                heap.pop();
+                sum = sum + a[top.i].coefficient * b[top.j].coefficient;
+                if (top.j == 0 && top.i + 1 < a.size())
+                    heap.push({a[top.i + 1].exponent + b[0].exponent, top.i + 1, 0});
+                if (top.j + 1 < b.size())
+                    heap.push({a[top.i].exponent + b[top.j + 1].exponent, top.i, top.j + 1});
+            }
+            if (!(sum == zero)) result.terms.push_back({exponent, std::move(sum)});
+        }
+        return result;
+    }
+};
+
+
+/**
+ * @brief Деление с остатком. Остаток хранится словарем по убыванию степени: каждый шаг снимает старший
+ * член и вычитает из остатка один член частного, умноженный на делитель, - O(q * b * log) по числу членов.
+ */
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class DivRem : public Mapping<DivRem<T>, std::pair<SparsePolynomial<T>, SparsePolynomial<T>>,
+                              SparsePolynomial<T>, SparsePolynomial<T>>
+{
+public:
+    static std::pair<SparsePolynomial<T>, SparsePolynomial<T>> calc(SparsePolynomial<T> dividend,
+                                                                    SparsePolynomial<T> divisor) {
+        if (divisor.isZero())
+            throw UniversalStringException("SparsePolynomial: cannot divide by zero polynomial");
+        if (dividend.isZero() || dividend.degree() < divisor.degree())
+            return {SparsePolynomial<T>(), std::move(dividend)};
+
+        if (isDense(dividend) && isDense(divisor)) {
+            auto [q, r] = Poly::DivRem<T>::execute(ToDense<T>::execute(dividend), ToDense<T>::execute(divisor));
+            return {FromDense<T>::execute(q), FromDense<T>::execute(r)};
+        }
+
+        T zero = T::zero();
+        T one = T::identity();
+        T inv_leading = one / divisor.terms.back().coefficient;
+        std::uint64_t shift_bound = divisor.degree();
+
+        std::map<std::uint64_t, T, std::greater<std::uint64_t>> remainder;
+        for (SparseTerm<T>& term : dividend.terms) remainder.emplace(term.exponent, std::move(term.coefficient));
+
+        SparsePolynomial<T> quotient;
+        while (!remainder.empty() && remainder.begin()->first >= shift_bound) {
+            std::uint64_t shift = remainder.begin()->first - shift_bound;
+            T coeff = remainder.begin()->second * inv_leading;
+            remainder.erase(remainder.begin());
+            for (std::size_t j = 0; j + 1 < divisor.terms.size(); ++j) {
+                T product = divisor.terms[j].coefficient * coeff;
+                auto [it, inserted] = remainder.emplace(divisor.terms[j].exponent + shift, zero - product);
+                if (!inserted) {
+                    it->second = it->second - product;
+                    if (it->second == zero) remainder.erase(it);
+                }
+            }
+            quotient.terms.push_back({shift, std::move(coeff)});
+        }
+
+        std::reverse(quotient.terms.begin(), quotient.terms.end());
+        SparsePolynomial<T> rest;
+        rest.terms.reserve(remainder.size());
+        for (auto it = remainder.rbegin(); it != remainder.rend(); ++it) rest.terms.push_back({it->first, std::move(it->second)});
+        return {std::move(quotient), std::move(rest)};
+    }
+};
+
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class Div : public BinaryOperation<Div<T>, SparsePolynomial<T>>
+{
+public:
+    static SparsePolynomial<T> calc(SparsePolynomial<T> p1, SparsePolynomial<T> p2) {
+        return DivRem<T>::execute(p1, p2).first;
+    }
+};
+
+template<typename T>
+requires Field<typename T::SetType, typename T::AdditionOp, typename T::MultiplicationOp>
+class Rem : public BinaryOperation<Rem<T>, SparsePolynomial<T>>
+{
+public:
+    static SparsePolynomial<T> calc(SparsePolynomial<T> p1, SparsePolynomial<T> p2) {
+        return DivRem<T>::execute(p1, p2).second;
+    }
+};
+
+
+template<typename T>
+class Derivative : public UnaryOperation<Derivative<T>, SparsePolynomial<T>>
+{
+public:
+    static SparsePolynomial<T> calc(SparsePolynomial<T> poly) {
+        T zero = T::zero();
+        SparsePolynomial<T> result;
+        result.terms.reserve(poly.terms.size());
+        for (const SparseTerm<T>& term : poly.terms) {
+            if (term.exponent == 0) continue;
+            T coeff = Poly::mulByIndex(term.coefficient, term.exponent);
+            if (!(coeff == zero)) result.terms.push_back({term.exponent - 1, std::move(coeff)});   // над Zp i может делиться на p
+        }
+        return result;
+    }
+};
+
+
+// x^n бинарным возведением: цепочка сложений показателей длины O(log n).
+template<typename T>
+T power(T x, std::uint64_t n) {
+    T result = T::identity();
+    for (; n > 0; n >>= 1) {
+        if (n & 1) result = result * x;
+        if (n > 1) x = x * x;
+    }
+    return result;
+}
+
+/**
+ * @brief Значение в точке разреженной схемой Горнера: между соседними членами x возводится в степень
+ * разности показателей, так что x^1000000 + 1 стоит около 20 умножений. Степень для повторяющейся
+ * разности (обычный случай для рядов с шагом) не пересчитывается.
+ */
+template<typename T>
+class Evaluate : public Mapping<Evaluate<T>, T, SparsePolynomial<T>, T>
+{
+public:
+    static T calc(SparsePolynomial<T> poly, T x) {
+        if (poly.isZero()) return T::zero();
+        T result = poly.terms.back().coefficient;
+        std::uint64_t last_gap = 0;
+        T last_power = T::identity();
+        for (std::size_t k = poly.terms.size() - 1; k-- > 0;) {
+            std::uint64_t gap = poly.terms[k + 1].exponent - poly.terms[k].exponent;
+            if (gap != last_gap) {
+                last_power = power(x, gap);
+                last_gap = gap;
+            }
+            result = result * last_power + poly.terms[k].coefficient;
+        }
+        if (poly.terms.front().exponent > 0) result = result * power(x, poly.terms.front().exponent);
+        return result;
+    }
+};
+
+/**
+ * @brief Строка в той же записи, что и у плотного полинома; проход только по ненулевым членам.
+ */
+template<typename T>
+class toString : public Mapping<toString<T>, std::string, SparsePolynomial<T>>
+{
+public:
+    static std::string calc(SparsePolynomial<T> poly) {
+        std::string result;
+        for (std::size_t k = poly.terms.size(); k-- > 0;) {
+            Poly::appendTerm(result, poly.terms[k].coefficient, poly.terms[k].exponent, k + 1 == poly.terms.size());
+        }
+        return result.empty() ? "0" : result;
+    }
+};
+
+}
+
+/**
+ * @brief Регистрация дистрибутивности: умножение дистрибутивно относительно сложения.
+ */
+template<typename T>
+struct Distributive<Sparse::Mul<T>, Sparse::Add<T>> {};
+
+#endif //SPARSE_OPERATIONS_POLYNOM_H
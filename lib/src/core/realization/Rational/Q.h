@@ -7,6 +7,7 @@
 #include "../../abstract/structures/groups.h"
 #include "../../abstract/structures/rings.h"
 #include "../Rational/operations.h"
+#include "../Rational/continued_fraction.h"
 
 
 
@@ -25,47 +26,112 @@ public:
     using MultiplicationOp = Rat::Mul;
 	using SetType = Rational;
 
-    Q(Rational v) : value(std::move(v)) {}
-    Q(Z numerator, N denumerator) : value(numerator, denumerator) {}
+    constexpr Q(Rational v) : value(std::move(v)) {}
+    constexpr Q(Z numerator, N denumerator) : value(numerator, denumerator) {}
+    constexpr explicit Q(std::int64_t v) : value(Z(v), N(std::uint64_t{1})) {}
 
 
-    Q operator+(const Q& other) const { 
+    constexpr Q operator+(const Q& other) const { 
         return Q(Rat::Add::execute(value, other.value));
     }
 
-    Q operator*(const Q& other) const {
+    constexpr Q operator*(const Q& other) const {
         return Q(Rat::Mul::execute(value, other.value));
     }
 
-    Q operator-(const Q& other) const {
+    constexpr Q operator-(const Q& other) const {
         return Q(Rat::Sub::execute(value, other.value));
     }
 
-    Q operator/(const Q& other) const {
+    constexpr Q operator/(const Q& other) const {
         return Q(Rat::Div::execute(value, other.value));
     }
 
 
-    bool operator>(const Q& other) const {
+    constexpr bool operator>(const Q& other) const {
         return Rat::Cmp::execute(value, other.value) == 2;
     }
 
-    bool operator<(const Q& other) const {
+    constexpr bool operator<(const Q& other) const {
         return Rat::Cmp::execute(value, other.value) == 1;
     }
 
-    bool operator==(const Q& other) const {
+    constexpr bool operator==(const Q& other) const {
         return Rat::Cmp::execute(value, other.value) == 0;
     }
 
-    void reduce(){
+    constexpr void reduce(){
        value = Rat::Red::execute(value);
     }
 
-    bool isNegative() const { return value.numerator.isNegative(); }
+    // Доводит отложенное сокращение, дробь без флага unreduced не трогает.
+    constexpr void normalize(){
+       value = Rat::Normalize::execute(value);
+    }
+
+    constexpr bool isReduced() const { return !value.unreduced; }
+
+    constexpr bool isNegative() const { return value.numerator.isNegative(); }
+
+    // Операции с машинным словом.
+    constexpr Q addUi(std::uint64_t k) const {
+        return Q(Rat::AddUi::execute(value, k));
+    }
+
+    constexpr Q mulUi(std::uint64_t k) const {
+        return Q(Rat::MulUi::execute(value, k));
+    }
+
+    constexpr Q divUi(std::uint64_t k) const {
+        return Q(Rat::DivUi::execute(value, k));
+    }
+
+    constexpr int cmpUi(std::uint64_t k) const {
+        return Rat::CmpUi::execute(value, k);
+    }
+
+    // Точный квадратный корень, если он рационален.
+    constexpr std::optional<Q> sqrt() const {
+        std::optional<Rational> root = Rat::Sqrt::execute(value);
+        if (!root)
+            return std::nullopt;
+        return Q(std::move(*root));
+    }
+
+    constexpr bool isPerfectSquare() const { return Rat::Sqrt::execute(value).has_value(); }
+
+    // Цепная дробь [a0; a1, ..., an] и обратное построение.
+    std::vector<Z> continuedFraction() const { return Rat::ContinuedFraction::execute(value); }
 
-    static Q zero() { return Q(Z::zero(), N({1})); }
-    static Q identity() { return Q(Z::identity(), N({1})); }  // 1/1
+    static Q fromContinuedFraction(const std::vector<Z>& quotients) {
+        return Q(Rat::FromContinuedFraction::execute(quotients));
+    }
+
+    // Ближайшая дробь со знаменателем не больше max_denominator.
+    Q bestApproximation(const N& max_denominator) const {
+        return Q(Rat::BestApproximation::execute(value, max_denominator));
+    }
+
+    // Поток подходящих дробей, считается лениво.
+    Rat::ConvergentStream convergents() const { return Rat::ConvergentStream(value); }
+
+    constexpr const Rational& get() const { return value; }
+
+    constexpr bool isZero() const { return value.numerator.isZero(); }
+    // Дробь может быть не сокращена, поэтому сравниваем числитель со знаменателем.
+    constexpr bool isOne() const {
+        return !value.numerator.isNegative() && Int::Abs::execute(value.numerator.get()) == value.denominator;
+    }
+
+    static const Q& zero() {
+        static const Q instance(std::int64_t{0});
+        return instance;
+    }
+
+    static const Q& identity() {  // 1/1
+        static const Q instance(std::int64_t{1});
+        return instance;
+    }
 
     std::string toString() const {
         return Rat::toString::execute(value);
@@ -73,6 +139,14 @@ public:
 };
 
 
+/**
+ * @brief Литерал рационального числа: 3_Q / 4_Q.
+ */
+constexpr Q operator""_Q(const char* literal) {
+    return Q(operator""_Z(literal), N(std::uint64_t{1}));
+}
+
+
 
 /**
  * Пример использования в полиноме:
@@ -0,0 +1,244 @@
+#ifndef CONTINUED_FRACTION_RATIONAL_H
+#define CONTINUED_FRACTION_RATIONAL_H
+
+#include <deque>
+#include <optional>
+#include <vector>
+
+#include "operations.h"
+
+/**
+ * В данном файле цепные дроби: разложение a/b = [a0; a1, a2, ...], поток подходящих дробей и наилучшее
+ * рациональное приближение с ограниченным знаменателем.
+ *
+ * Неполные частные - это частные алгоритма Евклида, поэтому они берутся из того же деления с остатком.
+ * Для длинных чисел используется прием Лемера: по старшим 18 цифрам a и b частные считаются в машинных
+ * словах, пока они гарантированно совпадают с частными полных чисел, и накопленная матрица 2x2 применяется
+ * к длинным числам одним шагом. Большинство шагов Евклида так обходится без длинного деления.
+ */
+
+namespace Rat {
+
+/**
+ * @brief Поток неполных частных a/b. Первое частное - floor(a/b) и может быть отрицательным,
+ * остальные положительны.
+ */
+class QuotientStream {
+private:
+    static constexpr std::size_t lehmer_digits = 18;
+
+    Natural a;
+    Natural b;
+    std::deque<Z> pending;
+
+    static constexpr std::uint64_t topDigits(const Natural& num, std::size_t skip) {
+        std::uint64_t value = 0;
+        for (std::size_t i = num.nums.size(); i-- > skip;) value = value * 10 + num.nums[i];
+        return value;
+    }
+
+    // Шаг Евклида по словам для чисел, целиком помещающихся в слово.
+    void wordSteps() {
+        std::uint64_t x = NatOper::ToUi::execute(a);
+        std::uint64_t y = NatOper::ToUi::execute(b);
+        while (y != 0) {
+            pending.push_back(Z(Natural(x / y), false));
+            std::uint64_t r = x % y;
+            x = y;
+            y = r;
+        }
+        a = Natural(x);
+        b = Natural(std::uint64_t{0});
+    }
+
+    // Один шаг Лемера: серия частных по старшим цифрам или, если она пуста, одно длинное деление.
+    void lehmerStep() {
+        std::size_t skip = a.nums.size() - lehmer_digits;
+        __int128 x = topDigits(a, skip);
+        __int128 y = topDigits(b, skip);
+        __int128 A = 1, B = 0, C = 0, D = 1;
+        std::size_t found = 0;
+        while (y + C != 0 && y + D != 0) {
+            __int128 q = (x + A) / (y + C);
+            if (q != (x + B) / (y + D)) break;
+            pending.push_back(Z(Natural(static_cast<std::uint64_t>(q)), false));
+            ++found;
+            __int128 t = A - q * C; A = C; C = t;
+            t = B - q * D; B = D; D = t;
+            t = x - q * y; x = y; y = t;
+        }
+
+        if (found == 0) {
+            auto [q, r] = NatOper::divideWithRemainder(a, b);
+            pending.push_back(Z(q, false));
+            a = std::move(b);
+            b = std::move(r);
+            return;
+        }
+
+        auto word = [](__int128 v) { return Z(static_cast<std::int64_t>(v)); };
+        Z za(a, false);
+        Z zb(b, false);
+        a = Int::Abs::execute((za * word(A) + zb * word(B)).get()).get();
+        b = Int::Abs::execute((za * word(C) + zb * word(D)).get()).get();
+    }
+
+public:
+    // Отношение натуральных чисел тоже передается сюда: Z(N) строится неявно.
+    QuotientStream(const Z& numerator, const N& denominator)
+        : a(Int::Abs::execute(numerator.get()).get()), b(denominator.get()) {
+        if (b.isZero())
+            throw UniversalStringException("ContinuedFraction: denominator can not be zero");
+
+        // Первое частное - с округлением вниз, дальше работаем с положительным остатком.
+        auto [q, r] = NatOper::divideWithRemainder(a, b);
+        if (!numerator.isNegative() || r.isZero()) {
+            pending.push_back(Z(q, numerator.isNegative()));
+            a = std::move(b);
+            b = std::move(r);
+        } else {
+            pending.push_back(Z(NatOper::AddUi::execute(q, 1), true));
+            Natural rest = NatOper::Sub::execute(b, r);
+            a = std::move(b);
+            b = std::move(rest);
+        }
+    }
+
+    std::optional<Z> next() {
+        while (pending.empty()) {
+            if (b.isZero()) return std::nullopt;
+            if (a.nums.size() <= lehmer_digits) {
+                wordSteps();
+            } else {
+                lehmerStep();
+            }
+        }
+        Z q = std::move(pending.front());
+        pending.pop_front();
+        return q;
+    }
+};
+
+
+/**
+ * @brief Разложение в цепную дробь [a0; a1, ..., an], последнее частное больше 1 (кроме целых чисел).
+ */
+class ContinuedFraction : public Mapping<ContinuedFraction, std::vector<Z>, Rational>
+{
+public:
+    static std::vector<Z> calc(Rational num) {
+        QuotientStream stream(num.numerator, num.denominator);
+        std::vector<Z> quotients;
+        while (std::optional<Z> q = stream.next()) quotients.push_back(std::move(*q));
+        return quotients;
+    }
+};
+
+/**
+ * @brief Дробь по неполным частным [a0; a1, ..., an].
+ */
+class FromContinuedFraction : public Mapping<FromContinuedFraction, Rational, std::vector<Z>>
+{
+public:
+    static Rational calc(std::vector<Z> quotients) {
+        if (quotients.empty())
+            throw UniversalStringException("ContinuedFraction: empty expansion");
+        Z p = quotients.back();
+        Z q(std::int64_t{1});
+        for (std::size_t i = quotients.size() - 1; i-- > 0;) {
+            Z next_p = quotients[i] * p + q;
+            q = p;
+            p = next_p;
+        }
+        if (q.isNegative()) {
+            p = -p;
+            q = -q;
+        }
+        return Rational(p, Int::Abs::execute(q.get()));
+    }
+};
+
+
+/**
+ * @brief Поток подходящих дробей p_k / q_k: p_k = a_k p_{k-1} + p_{k-2}, q_k = a_k q_{k-1} + q_{k-2}.
+ *
+ * @code
+ * Rat::ConvergentStream stream(x);
+ * while (auto c = stream.next()) { ... }
+ * @endcode
+ */
+class ConvergentStream {
+private:
+    QuotientStream quotients;
+    Z p_prev{std::int64_t{0}};
+    Z p{std::int64_t{1}};
+    Z q_prev{std::int64_t{1}};
+    Z q{std::int64_t{0}};
+
+public:
+    explicit ConvergentStream(const Rational& num) : quotients(num.numerator, num.denominator) {}
+
+    std::optional<Rational> next() {
+        std::optional<Z> a = quotients.next();
+        if (!a) return std::nullopt;
+        Z next_p = *a * p + p_prev;
+        Z next_q = *a * q + q_prev;
+        p_prev = std::move(p);
+        q_prev = std::move(q);
+        p = std::move(next_p);
+        q = std::move(next_q);
+        return Rational(p, Int::Abs::execute(q.get()));
+    }
+
+    // Предыдущая подходящая дробь p_{k-1} / q_{k-1}; до первого next это 1/0, поэтому хранится в Z.
+    const Z& previousNumerator() const { return p_prev; }
+    const Z& previousDenominator() const { return q_prev; }
+};
+
+
+/**
+ * @brief Наилучшее приближение дробью со знаменателем не больше max_denominator: ближайшая к числу из
+ * последней подходящей дроби p_k / q_k, укладывающейся в границу, и промежуточной дроби
+ * (p_{k-1} + t p_k) / (q_{k-1} + t q_k) с наибольшим допустимым t. При равенстве берется подходящая дробь.
+ */
+class BestApproximation : public Mapping<BestApproximation, Rational, Rational, N>
+{
+private:
+    static Rational distance(const Rational& a, const Rational& b) {
+        Rational diff = Sub::execute(a, b);
+        if (diff.numerator.isNegative()) diff.numerator = -diff.numerator;
+        return diff;
+    }
+
+public:
+    static Rational calc(Rational num, N max_denominator) {
+        if (max_denominator.isZero())
+            throw UniversalStringException("ContinuedFraction: denominator bound must be positive");
+
+        Z bound(max_denominator);
+        ConvergentStream stream(num);
+        Rational best = *stream.next();
+        while (true) {
+            Z p_prev = stream.previousNumerator();
+            Z q_prev = stream.previousDenominator();
+            std::optional<Rational> next = stream.next();
+            if (!next) return best;
+            if (!(Z(next->denominator) > bound)) {
+                best = std::move(*next);
+                continue;
+            }
+
+            Z q_best(best.denominator);
+            Z t = (bound - q_prev) / q_best;
+            if (t.isZero()) return best;
+            Z semi_q = q_prev + t * q_best;
+            Rational semi(p_prev + t * best.numerator, Int::Abs::execute(semi_q.get()));
+            if (Cmp::execute(distance(num, semi), distance(num, best)) == 1) return semi;
+            return best;
+        }
+    }
+};
+
+}
+
+#endif //CONTINUED_FRACTION_RATIONAL_H
@@ -1,6 +1,10 @@
 #ifndef OPERATIONS_RATIONAL_H
 #define OPERATIONS_RATIONAL_H
 
+#include <algorithm>
+#include <numeric>
+#include <optional>
+
 #include "../../abstract/types/rational.h"
 
 #include "../../abstract/transformations/operations/unary.h"
@@ -9,13 +13,127 @@
 namespace Rat {
 
 
+/**
+ * @brief Оператор сокращение дроби.
+ */
+class Red : public UnaryOperation<Red, Rational>
+{
+public:
+    static constexpr Rational calc(Rational num) { 
+        N numerator_abs = Z::abs(num.numerator);
+        N gcd = N::gcd(numerator_abs, num.denominator);
+        
+        if (gcd.isOne()) {
+            num.unreduced = false;
+            return num;
+        }
+        
+        Z gcd_as_int = Z(gcd.get(), false);
+        return Rational(num.numerator / gcd_as_int, num.denominator / gcd);
+    }
+};
+
+/**
+ * @brief Доведение отложенного сокращения. Дробь без флага unreduced возвращается как есть,
+ * так что повторная нормализация ничего не стоит.
+ */
+class Normalize : public UnaryOperation<Normalize, Rational>
+{
+public:
+    static constexpr Rational calc(Rational num) {
+        if (!num.unreduced)
+            return num;
+        return Red::execute(num);
+    }
+};
+
+
 /**
  * @brief Оператор сравнения элементов в Рациональных числах.
+ *
+ * Сравнение поэтапное, полные перекрестные произведения строятся только если дешевые проверки не дали ответа:
+ *  1. знаки числителей;
+ *  2. оценка порядка по числу цифр: |a/b| лежит в (10^(la-lb-1), 10^(la-lb+1));
+ *  3. сравнение по старшим 18 цифрам всех четырех чисел в long double с запасом на погрешность;
+ *  4. точное сравнение a*d и c*b, перед ним доводится отложенное сокращение.
  */
 class Cmp : public Mapping<Cmp, int, Rational, Rational>
 {
+private:
+    static constexpr size_t leading_digits = 18;
+    static constexpr long double approx_tolerance = 1e-15L;
+
+    // Старшие цифры модуля числа: value * 10^shift <= |num| < (value + 1) * 10^shift.
+    struct Leading {
+        std::uint64_t value;
+        std::int64_t shift;
+        std::int64_t digits;
+    };
+
+    static constexpr Leading leadingOf(const Natural& num) {
+        std::int64_t digits = static_cast<std::int64_t>(num.nums.size());
+        size_t taken = std::min(num.nums.size(), leading_digits);
+        std::uint64_t value = 0;
+        for (size_t i = 0; i < taken; ++i) {
+            value = value * 10 + num.nums[num.nums.size() - 1 - i];
+        }
+        return {value, digits - static_cast<std::int64_t>(taken), digits};
+    }
+
+    static constexpr Leading leadingOf(const Integer& num) {
+        if (!num.is_small)
+            return leadingOf(num.natural.get());
+        std::uint64_t value = num.small < 0 ? static_cast<std::uint64_t>(-num.small) : static_cast<std::uint64_t>(num.small);
+        std::int64_t digits = 1;
+        for (std::uint64_t rest = value / 10; rest != 0; rest /= 10) ++digits;
+        return {value, 0, digits};
+    }
+
+    // Сравнение |a|/b и |c|/d без длинного умножения, -1 если оценки не хватило.
+    static constexpr int estimate(const Rational& num1, const Rational& num2) {
+        Leading a = leadingOf(num1.numerator.get());
+        Leading b = leadingOf(num1.denominator.get());
+        Leading c = leadingOf(num2.numerator.get());
+        Leading d = leadingOf(num2.denominator.get());
+
+        std::int64_t order1 = a.digits - b.digits;
+        std::int64_t order2 = c.digits - d.digits;
+        if (order1 >= order2 + 2) return 2;
+        if (order2 >= order1 + 2) return 1;
+
+        // |a| * d против |c| * b по старшим цифрам, каждая отброшенная часть дает ошибку не больше 10^-17
+        long double left = static_cast<long double>(a.value) * static_cast<long double>(d.value);
+        long double right = static_cast<long double>(c.value) * static_cast<long double>(b.value);
+        std::int64_t shift = (a.shift + d.shift) - (c.shift + b.shift);
+        for (; shift > 0; --shift) left *= 10;
+        for (; shift < 0; ++shift) right *= 10;
+
+        if (left > right * (1 + approx_tolerance)) return 2;
+        if (left < right * (1 - approx_tolerance)) return 1;
+        return -1;
+    }
+
 public:
-    static int calc(Rational num1, Rational num2) { 
+    static constexpr int calc(Rational num1, Rational num2) { 
+        int sign1 = num1.numerator.isZero() ? 0 : (num1.numerator.isNegative() ? -1 : 1);
+        int sign2 = num2.numerator.isZero() ? 0 : (num2.numerator.isNegative() ? -1 : 1);
+        if (sign1 != sign2) return sign1 < sign2 ? 1 : 2;
+        if (sign1 == 0) return 0;
+
+        if (num1.denominator == num2.denominator) {
+            if (num1.numerator > num2.numerator) return 2;
+            if (num1.numerator < num2.numerator) return 1;
+            return 0;
+        }
+
+        // Оценка сравнивает модули, для отрицательных чисел порядок меняется.
+        int magnitude = estimate(num1, num2);
+        if (magnitude != -1)
+            return sign1 > 0 ? magnitude : 3 - magnitude;
+
+        num1 = Normalize::execute(num1);
+        num2 = Normalize::execute(num2);
+
         Z left = num1.numerator * Z(num2.denominator);
         Z right = num2.numerator * Z(num1.denominator);
         
@@ -28,38 +146,72 @@ public:
 };
 
 /**
- * @brief Оператор сокращение дроби.
+ * @brief Оператор проверки того что число целое
  */
-class Red : public UnaryOperation<Red, Rational>
+class isInt : public Mapping<isInt, bool, Rational>
 {
 public:
-    static Rational calc(Rational num) { 
-        N numerator_abs = Z::abs(num.numerator);
-        N gcd = N::gcd(numerator_abs, num.denominator);
-        
-        if (gcd == N({1}))
-            return num;
-        
-        Z gcd_as_int = Z(gcd.get(), false);
-        num.numerator = num.numerator / gcd_as_int;
-        num.denominator = num.denominator / gcd;
-
-        return num;
+    static constexpr bool calc(Rational num) { 
+        return Normalize::execute(num).denominator.isOne();
     }
 };
 
 
+
 /**
- * @brief Оператор проверки того что число целое
+ * Сложение и умножение сокращают результат лениво: вместо НОД на каждой операции результат помечается
+ * флагом unreduced, а сокращение выполняется при сравнении, печати, хэшировании или когда знаменатель
+ * перерастает lazy_reduce_digits десятичных цифр. При длинном накоплении сумм (коэффициенты в Poly::Mul<Q>)
+ * это дает один НОД в конце вместо НОД на каждое слагаемое.
+ *
+ * Сокращение на пороге и деление идут по Хенричи: НОД считается только от перекрестных членов, а не от
+ * полного результата, и промежуточные произведения получаются меньше. Для сокращенных операндов результат
+ * сразу несократим.
  */
-class isInt : public Mapping<isInt, bool, Rational>
-{
-public:
-    static bool calc(Rational num) { 
-        return num.denominator == N({1});
+inline constexpr size_t lazy_reduce_digits = 64;
+
+constexpr size_t digitsOf(const N& num) {
+    return num.get().nums.size();
+}
+
+// a/b + c/d для сокращенных дробей: g = gcd(b, d), сокращать сумму достаточно только на делители g.
+constexpr Rational henriciAdd(const Rational& num1, const Rational& num2) {
+    N g = N::gcd(num1.denominator, num2.denominator);
+    if (g.isOne()) {
+        Z numerator = num1.numerator * Z(num2.denominator) + num2.numerator * Z(num1.denominator);
+        return Rational(numerator, num1.denominator * num2.denominator);
     }
-};
 
+    N b = num1.denominator / g;
+    N d = num2.denominator / g;
+    Z t = num1.numerator * Z(d) + num2.numerator * Z(b);
+    if (t.isZero())
+        return Rational(t, N(std::uint64_t{1}));
+    N g2 = N::gcd(Z::abs(t), g);
+    if (g2.isOne())
+        return Rational(t, b * num2.denominator);
+    return Rational(t / Z(g2), b * (num2.denominator / g2));
+}
+
+// (a/b) * (c/d) для сокращенных дробей: до умножения сокращаем крест-накрест на gcd(a, d) и gcd(c, b).
+constexpr Rational henriciMul(const Rational& num1, const Rational& num2) {
+    Z a = num1.numerator;
+    Z c = num2.numerator;
+    N g1 = N::gcd(Z::abs(a), num2.denominator);
+    N g2 = N::gcd(Z::abs(c), num1.denominator);
+
+    N b = num1.denominator;
+    N d = num2.denominator;
+    if (!g1.isOne()) {
+        a = a / Z(g1);
+        d = d / g1;
+    }
+    if (!g2.isOne()) {
+        c = c / Z(g2);
+        b = b / g2;
+    }
+    return Rational(a * c, b * d);
+}
 
 
 /**
@@ -73,20 +225,27 @@ class Add : public BinaryOperation<Add, Rational>,
             public Inverse
 {
 public:
-    static Rational calc(Rational num1, Rational num2) { 
-        N common_denom = N::lcm(num1.denominator, num2.denominator);
-    
-        N factor_this = common_denom / num1.denominator;
-        N factor_other = common_denom / num2.denominator;
-
-        Z new_num_this = num1.numerator * Z(factor_this);
-        Z new_num_other = num2.numerator * Z(factor_other);
-        
-        Z sum_numerator = new_num_this + new_num_other;
-        
-        Rational result(sum_numerator, common_denom);
-        result = Red::execute(result);
-        return result;
+    static constexpr Rational calc(Rational num1, Rational num2) { 
+        // Общий знаменатель не растет, поэтому сокращение можно откладывать сколько угодно.
+        if (num1.denominator == num2.denominator) {
+            bool integral = num1.denominator.isOne();
+            return Rational(num1.numerator + num2.numerator, num1.denominator, !integral);
+        }
+
+        // a/b + k = (a + k*b)/b, сократимость не меняется (см. AddUi).
+        if (num2.denominator.isOne())
+            return Rational(num1.numerator + num2.numerator * Z(num1.denominator), num1.denominator, num1.unreduced);
+        if (num1.denominator.isOne())
+            return Rational(num2.numerator + num1.numerator * Z(num2.denominator), num2.denominator, num2.unreduced);
+
+        if (digitsOf(num1.denominator) + digitsOf(num2.denominator) > lazy_reduce_digits) {
+            if (!num1.unreduced && !num2.unreduced)
+                return henriciAdd(num1, num2);
+            return henriciAdd(Normalize::execute(num1), Normalize::execute(num2));
+        }
+
+        Z numerator = num1.numerator * Z(num2.denominator) + num2.numerator * Z(num1.denominator);
+        return Rational(numerator, num1.denominator * num2.denominator, true);
     }
 };
 
@@ -96,9 +255,8 @@ public:
 class Sub : public BinaryOperation<Sub, Rational>
 {
 public:
-    static Rational calc(Rational num1, Rational num2) { 
-        num2.numerator = -num2.numerator;
-        return Add::execute(num1, num2);
+    static constexpr Rational calc(Rational num1, Rational num2) { 
+        return Add::execute(num1, Rational(-num2.numerator, num2.denominator, num2.unreduced));
     }
 };
 
@@ -113,13 +271,14 @@ class Mul : public BinaryOperation<Mul, Rational>,
             public Inverse
 {
 public:
-    static Rational calc(Rational num1, Rational num2) { 
-        Z new_numerator = num1.numerator * num2.numerator;
-        N new_denominator = num1.denominator * num2.denominator;
-        
-        Rational result(new_numerator, new_denominator);
-        result = Red::execute(result);
-        return result;
+    static constexpr Rational calc(Rational num1, Rational num2) { 
+        if (num1.denominator.isOne() && num2.denominator.isOne())
+            return Rational(num1.numerator * num2.numerator, num1.denominator);
+
+        if (digitsOf(num1.denominator) + digitsOf(num2.denominator) > lazy_reduce_digits)
+            return henriciMul(Normalize::execute(num1), Normalize::execute(num2));
+
+        return Rational(num1.numerator * num2.numerator, num1.denominator * num2.denominator, true);
     }
         
 };
@@ -131,25 +290,106 @@ public:
 class Div : public BinaryOperation<Div, Rational>
 {
 public:
-    static Rational calc(Rational num1, Rational num2) { 
-         if (num2.numerator  == Z(N({0})))
+    static constexpr Rational calc(Rational num1, Rational num2) { 
+         if (num2.numerator.isZero())
             throw UniversalStringException("Rational:  cannot divide by zero");
         
-        Z new_numerator = num1.numerator * Z(num2.denominator);
-        
-        N other_num_abs = Z::abs(num2.numerator);
-        N new_denominator = num1.denominator * other_num_abs;
-        
-        if (num2.numerator < Z(N({0})))
+        // Деление - умножение на обратную дробь, знак переносится в числитель.
+        Z reciprocal_numerator(num2.denominator);
+        if (num2.numerator.isNegative())
+            reciprocal_numerator = -reciprocal_numerator;
+        Rational reciprocal(reciprocal_numerator, Z::abs(num2.numerator), num2.unreduced);
+
+        return henriciMul(Normalize::execute(num1), Normalize::execute(reciprocal));
+    }
+};
+
+
+/**
+ * @brief Сложение рационального числа с машинным словом: a/b + k = (a + k*b)/b.
+ * НОД не нужен, так как gcd(a + k*b, b) = gcd(a, b), то есть несократимая дробь остается несократимой.
+ */
+class AddUi : public Mapping<AddUi, Rational, Rational, std::uint64_t>
+{
+public:
+    static constexpr Rational calc(Rational num, std::uint64_t k) {
+        Z shift = Z(num.denominator.mulUi(k));
+        return Rational(num.numerator + shift, num.denominator, num.unreduced);
+    }
+};
+
+
+/**
+ * @brief Умножение рационального числа на машинное слово.
+ * Сначала сокращаем k со знаменателем, НОД при этом считается по машинным словам.
+ */
+class MulUi : public Mapping<MulUi, Rational, Rational, std::uint64_t>
+{
+public:
+    static constexpr Rational calc(Rational num, std::uint64_t k) {
+        if (k == 0)
+            return Rational(Z(std::int64_t{0}), N(std::uint64_t{1}));
+
+        std::uint64_t g = std::gcd(k, num.denominator.divmodUi(k).second);
+        return Rational(num.numerator.mulUi(k / g), num.denominator.divmodUi(g).first, num.unreduced);
+    }
+};
+
+
+/**
+ * @brief Деление рационального числа на машинное слово.
+ */
+class DivUi : public Mapping<DivUi, Rational, Rational, std::uint64_t>
+{
+public:
+    static constexpr Rational calc(Rational num, std::uint64_t k) {
+        if (k == 0)
+            throw UniversalStringException("Rational:  cannot divide by zero");
+
+        N numerator_abs = Z::abs(num.numerator);
+        std::uint64_t g = std::gcd(k, numerator_abs.divmodUi(k).second);
+        Z new_numerator(numerator_abs.divmodUi(g).first);
+        if (num.numerator.isNegative())
             new_numerator = -new_numerator;
-        
-        Rational result(new_numerator, new_denominator);
-        result = Red::execute(result);
-        return result;
+        return Rational(new_numerator, num.denominator.mulUi(k / g), num.unreduced);
+    }
+};
+
+
+/**
+ * @brief Сравнение рационального числа с машинным словом, результат в тех же кодах, что и у Cmp.
+ */
+class CmpUi : public Mapping<CmpUi, int, Rational, std::uint64_t>
+{
+public:
+    static constexpr int calc(Rational num, std::uint64_t k) {
+        if (num.numerator.isNegative()) return 1;
+        N scaled = num.denominator.mulUi(k);
+        N numerator_abs = Z::abs(num.numerator);
+        if (numerator_abs > scaled) return 2;
+        if (numerator_abs < scaled) return 1;
+        return 0;
     }
 };
 
 
+/**
+ * @brief Точный квадратный корень из рационального числа. У сокращенной дроби корень рационален
+ * ровно тогда, когда числитель и знаменатель - полные квадраты, иначе возвращается std::nullopt.
+ */
+class Sqrt : public Mapping<Sqrt, std::optional<Rational>, Rational>
+{
+public:
+    static constexpr std::optional<Rational> calc(Rational num) {
+        if (num.numerator.isNegative())
+            return std::nullopt;
+        Rational reduced = Red::execute(num);
+        if (!reduced.numerator.isPerfectSquare() || !reduced.denominator.isPerfectSquare())
+            return std::nullopt;
+        return Rational(reduced.numerator.isqrt(), reduced.denominator.isqrt());
+    }
+};
+
 /**
  * @brief Оператор перевода рациональных числа в строку.
  */
@@ -157,6 +397,7 @@ class toString : public Mapping<toString, std::string, Rational>
 {
 public:
     static std::string calc(Rational num) { 
+        num = Normalize::execute(num);
         return num.numerator.toString() + "/" + num.denominator.toString();
     }
 };
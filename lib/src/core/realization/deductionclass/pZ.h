@@ -3,9 +3,11 @@
 
 #include "principal_ideal_z.h"
 #include "../../abstract/structures/factor.h"
+#include "../Polynomial/ntt.h"   // умножение P<Zp<p>> через NTT
 
 /**
  * @brief Z/pZ - поле вычетов по модулю p (p простое)
+ * Полиномы над Zp длиной от Poly::TransformMul::threshold умножаются через NTT (см. Polynomial/ntt.h).
  */
 template<size_t p>
 using Zp = FactorField<Z, PrincipalIdealZ<p>>;
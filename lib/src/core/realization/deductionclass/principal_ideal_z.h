@@ -1,6 +1,8 @@
 #ifndef PRINCIPAL_IDEAL_Z_H
 #define PRINCIPAL_IDEAL_Z_H
 
+#include <type_traits>
+
 #include "../Integer/Z.h"
 #include "../../abstract/structures/commuttative_algebra.h"
 
@@ -8,28 +10,24 @@
 /**
  * @brief Главный идеал в Z, порожденный элементом n
  * I = nZ = {n·k | k ∈ Z}
+ *
+ * Идеал nZ максимален ровно тогда, когда n простое. Простота проверяется на этапе компиляции, поэтому
+ * тэг Maximal получают только простые n: FactorRing<Z, PrincipalIdealZ<4>> строится, а Zp<4> - нет.
  */
 template<size_t n>
-class PrincipalIdealZ : public Maximal {  
+class PrincipalIdealZ : public std::conditional_t<NatOper::isPrimeWord(n), Maximal, NotMaximal> {  
 public:
     using element_type = Z;
 
     static constexpr size_t generator = n;
     
     static bool contains(Z x) {
-        Z n_z = makeZ(n);
-        return (x % n_z) == Z::zero();
+        return x.divmodUi(n).second == 0;
     }
     
+    // Остаток от деления на машинное слово уже лежит в [0, n).
     static Z representative(Z x) {
-        Z n_z = makeZ(n);
-        Z rem = x % n_z;
-        
-        // Приводим к [0, n)
-        if (rem.isNegative()) {
-            rem = rem + n_z;
-        }
-        return rem;
+        return makeZ(x.divmodUi(n).second);
     }
     
     static Z compute_inverse(Z a) {
@@ -38,23 +36,14 @@ public:
 
 private:
     static Z makeZ(size_t value) {
-        std::vector<uint8_t> digits;
-        if (value == 0) {
-            digits.push_back(0);
-        } else {
-            while (value > 0) {
-                digits.push_back(value % 10);
-                value /= 10;
-            }
-        }
-        return Z(Natural(digits), false);
+        return Z(N(static_cast<std::uint64_t>(value)));
     }
     
     static Z modular_inverse(Z a, Z mod) {
         Z t = Z::zero(), newt = Z::identity();
         Z r = mod, newr = a;
         
-        while (newr != Z::zero()) {
+        while (!newr.isZero()) {
             Z quotient = r / newr;
             
             Z temp_t = t;
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include "core/realization/Ball/RealBall.h"
+#include "core/realization/Polynomial/P[x].h"
+
+// Шары вокруг точных значений
+TEST(BallConstruct1, Exactness) {
+    EXPECT_TRUE(RealBall(Q(1_Z, 8_N)).rad().isZero());
+    EXPECT_TRUE(RealBall(123456789012345678901234567890_Z, 30).rad().isZero());
+    EXPECT_FALSE(RealBall(123456789012345678901234567890_Z, 10).rad().isZero());
+    EXPECT_FALSE(RealBall(Q(1_Z, 3_N)).rad().isZero());
+    EXPECT_EQ(RealBall(Q(-5_Z, 2_N)).sign(), -1);
+    EXPECT_EQ(RealBall(std::int64_t{0}).sign(), 0);
+}
+
+// Точное значение всегда внутри шара
+TEST(BallArith1, Enclosure) {
+    RealBall third(Q(1_Z, 3_N), 20);
+    RealBall one(std::int64_t{1});
+    RealBall sum = third + third + third;
+    EXPECT_FALSE(sum.cmp(one).has_value());
+    EXPECT_TRUE((sum - one).containsZero());
+    EXPECT_FALSE((third * RealBall(std::int64_t{3}) - one).sign().has_value());
+    EXPECT_FALSE(sum.lower() > BigFloat(std::int64_t{1}));
+    EXPECT_FALSE(sum.upper() < BigFloat(std::int64_t{1}));
+
+    EXPECT_EQ(sum.cmp(RealBall(Q(99_Z, 100_N))), 2);
+    EXPECT_EQ(third.cmp(RealBall(Q(1_Z, 2_N))), 1);
+    EXPECT_EQ(RealBall(std::int64_t{2}).cmp(RealBall(std::int64_t{2})), 0);
+}
+
+TEST(BallArith2, Division) {
+    RealBall seventh = RealBall(std::int64_t{1}, 25) / RealBall(std::int64_t{7}, 25);
+    RealBall back = seventh * RealBall(std::int64_t{7});
+    EXPECT_FALSE((back - RealBall(std::int64_t{1})).sign().has_value());
+    EXPECT_EQ((seventh - RealBall(Q(142857_Z, 1000000_N))).sign(), 1);
+
+    RealBall around_zero(BigFloat(std::int64_t{0}), BigFloat(Q(1_Z, 10_N)));
+    EXPECT_THROW(RealBall(std::int64_t{1}) / around_zero, UniversalStringException);
+}
+
+// Знак полинома: шары решают общий случай, точный счет - только у корня
+TEST(BallPolySign1, SignAt) {
+    Polynomial<Q> poly({Q(-2_Z, 1_N), Q(0_Z, 1_N), Q(1_Z, 1_N)});   // x^2 - 2
+    EXPECT_EQ(Balls::SignAt::execute(poly, Q(3_Z, 2_N), 20), 1);
+    EXPECT_EQ(Balls::SignAt::execute(poly, Q(7_Z, 5_N), 20), -1);
+    EXPECT_EQ(Balls::SignAt::execute(poly, Q(141421356237_Z, 100000000000_N), 5), -1);
+
+    // (x - 1/3)(x - 1/7) = x^2 - 10/21 x + 1/21, корень 1/3 не представим в десятичной записи
+    Polynomial<Q> roots({Q(1_Z, 21_N), Q(-10_Z, 21_N), Q(1_Z, 1_N)});
+    EXPECT_EQ(Balls::SignAt::execute(roots, Q(1_Z, 3_N), 20), 0);
+    EXPECT_EQ(Balls::SignAt::execute(roots, Q(1_Z, 5_N), 20), -1);
+    EXPECT_EQ(P<Q>(roots).evaluate(Q(1_Z, 1_N)), Q(4_Z, 7_N));
+}
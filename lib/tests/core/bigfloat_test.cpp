@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "core/realization/Floating/BigFloat.h"
+
+// Деление и режимы округления
+TEST(BigFloatRound1, Modes) {
+    Q third(1_Z, 3_N);
+    EXPECT_EQ(BigFloat(third, 10).toString(), "3.333333333e-1");
+    EXPECT_EQ(BigFloat(third, 10, RoundingMode::TowardPositive).toString(), "3.333333334e-1");
+
+    Q minus_two_thirds(-2_Z, 3_N);
+    EXPECT_EQ(BigFloat(minus_two_thirds, 5).toString(), "-6.6667e-1");
+    EXPECT_EQ(BigFloat(minus_two_thirds, 5, RoundingMode::TowardZero).toString(), "-6.6666e-1");
+    EXPECT_EQ(BigFloat(minus_two_thirds, 5, RoundingMode::TowardPositive).toString(), "-6.6666e-1");
+    EXPECT_EQ(BigFloat(minus_two_thirds, 5, RoundingMode::TowardNegative).toString(), "-6.6667e-1");
+    EXPECT_EQ(BigFloat(Q(1_Z, 7_N), 25).toString(), "1.428571428571428571428571e-1");
+}
+
+TEST(BigFloatRound2, TiesAndCarry) {
+    EXPECT_EQ(BigFloat(Q(5_Z, 2_N), 1).toString(), "2e0");
+    EXPECT_EQ(BigFloat(Q(7_Z, 2_N), 1).toString(), "4e0");
+    EXPECT_EQ(BigFloat(Q(5_Z, 2_N), 1, RoundingMode::AwayFromZero).toString(), "3e0");
+    EXPECT_EQ(BigFloat(Q(999999_Z, 100000_N), 3).toString(), "1e1");
+    EXPECT_EQ(BigFloat(123456789_Z, 4).toString(), "1.235e8");
+}
+
+// Сложение с большим разрывом порядков и сокращение разрядов
+TEST(BigFloatAdd1, Sticky) {
+    BigFloat one(std::int64_t{1}, 10);
+    BigFloat tiny(Q(1_Z, N(NatOper::powerOfTen(100))), 10);
+    EXPECT_EQ((one + tiny).toString(), "1e0");
+    EXPECT_EQ(BigFloat::add(one, tiny, 10, RoundingMode::TowardPositive).toString(), "1.000000001e0");
+    EXPECT_EQ(BigFloat::sub(one, tiny, 10, RoundingMode::TowardZero).toString(), "9.999999999e-1");
+    EXPECT_EQ(BigFloat::sub(one, tiny, 10).toString(), "1e0");
+}
+
+TEST(BigFloatAdd2, Cancellation) {
+    BigFloat one(std::int64_t{1}, 30);
+    BigFloat x = one + BigFloat(Q(1_Z, N(NatOper::powerOfTen(20))), 30);
+    EXPECT_EQ((x - one).toString(), "1e-20");
+    EXPECT_TRUE((one - one).isZero());
+    EXPECT_EQ((BigFloat(std::int64_t{-3}) + BigFloat(std::int64_t{5})).toString(), "2e0");
+}
+
+// Умножение, деление, корень
+TEST(BigFloatArith1, MulDivSqrt) {
+    BigFloat two(std::int64_t{2}, 40);
+    EXPECT_EQ(two.sqrt().toString(), "1.41421356237309504880168872420969807857e0");
+    EXPECT_EQ(BigFloat::sqrt(two, 5, RoundingMode::TowardPositive).toString(), "1.4143e0");
+    EXPECT_EQ(BigFloat(Q(1_Z, 4_N)).sqrt().toString(), "5e-1");
+    EXPECT_EQ((BigFloat(std::int64_t{-6}) * BigFloat(Q(1_Z, 4_N))).toString(), "-1.5e0");
+    EXPECT_EQ((BigFloat(std::int64_t{1}, 20) / BigFloat(std::int64_t{3}, 20)).toString(), "3.3333333333333333333e-1");
+    EXPECT_THROW(BigFloat(std::int64_t{1}) / BigFloat(std::int64_t{0}), UniversalStringException);
+    EXPECT_THROW(BigFloat(std::int64_t{-1}).sqrt(), UniversalStringException);
+}
+
+// Точные преобразования и сравнение
+TEST(BigFloatConvert1, Exact) {
+    Q eighth(1_Z, 8_N);
+    EXPECT_EQ(BigFloat(eighth, 5).toQ(), eighth);
+    EXPECT_EQ(BigFloat(Q(-27_Z, 10_N)).toQ(), Q(-27_Z, 10_N));
+    EXPECT_EQ(BigFloat(123456789012345678901234567890_Z, 40).toZ(), 123456789012345678901234567890_Z);
+
+    BigFloat x(Q(27_Z, 10_N));
+    EXPECT_EQ(x.toZ(), 2_Z);
+    EXPECT_EQ(x.toZ(RoundingMode::Nearest), 3_Z);
+    BigFloat y(Q(-5_Z, 2_N));
+    EXPECT_EQ(y.toZ(RoundingMode::Nearest), -2_Z);
+    EXPECT_EQ(y.toZ(RoundingMode::TowardNegative), -3_Z);
+    EXPECT_EQ(BigFloat(Q(1_Z, 1000_N)).toZ(RoundingMode::TowardPositive), 1_Z);
+}
+
+TEST(BigFloatCmp1, Order) {
+    BigFloat a(Q(1_Z, 100000_N));
+    BigFloat b(Q(1_Z, 10000_N));
+    EXPECT_TRUE(a < b);
+    EXPECT_TRUE(-a > -b);
+    EXPECT_TRUE(BigFloat(std::int64_t{0}) < a);
+    EXPECT_TRUE(BigFloat(Q(1_Z, 2_N), 3) == BigFloat(Q(1_Z, 2_N), 50));
+    EXPECT_TRUE(BigFloat(Q(15_Z, 10_N)) > BigFloat(Q(149_Z, 100_N)));
+}
+
+// Элементарные функции: сравниваем с эталоном с точностью до двух единиц последнего разряда.
+static BigFloat decimal(const std::string& text, std::uint64_t precision) {
+    bool negative = text[0] == '-';
+    std::string body = negative ? text.substr(1) : text;
+    std::size_t point = body.find('.');
+    std::size_t fraction = point == std::string::npos ? 0 : body.size() - point - 1;
+    if (point != std::string::npos) body.erase(point, 1);
+    Z numerator(NatOper::fromString::execute(body), negative);
+    return BigFloat(Q(numerator, N(NatOper::powerOfTen(fraction))), precision + 10);
+}
+
+static void expectClose(const BigFloat& value, const std::string& reference, std::uint64_t precision) {
+    BigFloat expected = decimal(reference, precision);
+    BigFloat diff = BigFloat::sub(value, expected, precision + 10);
+    BigFloat abs_diff = diff.isNegative() ? -diff : diff;
+    BigFloat abs_expected = expected.isNegative() ? -expected : expected;
+    // |diff| <= 2 * 10^(1 - precision) * |expected|
+    BigFloat bound = BigFloat::mul(abs_expected, BigFloat(Q(2_Z, N(NatOper::powerOfTen(precision - 1))), 5), 5);
+    EXPECT_FALSE(abs_diff > bound) << value.toString() << " vs " << reference;
+}
+
+TEST(BigFloatElementary1, Constants) {
+    expectClose(BigFloat::pi(100), "3.141592653589793238462643383279502884197169399375105820974944592307816406286208998628034825342117068", 100);
+    expectClose(BigFloat::e(100), "2.718281828459045235360287471352662497757247093699959574966967627724076630353547594571382178525166427", 100);
+    expectClose(BigFloat::ln2(100), "0.6931471805599453094172321214581765680755001343602552541206800094933936219696947156058633269964186875", 100);
+    // Повторный запрос с меньшей точностью берется из кэша
+    EXPECT_EQ(BigFloat::pi(10).toString(), "3.141592654e0");
+    EXPECT_EQ(BigFloat::pi(10).precision(), 10u);
+}
+
+TEST(BigFloatElementary2, ExpLog) {
+    expectClose(BigFloat(Q(1_Z, 2_N), 50).exp(), "1.6487212707001281468486507878141635716537761007101", 50);
+    expectClose(BigFloat(std::int64_t{-10}, 50).exp(), "0.000045399929762484851535591515560550610237918088866565", 50);
+    expectClose(BigFloat(std::int64_t{100}, 50).exp(), "26881171418161354484126255515800135873611118.773742", 50);
+    expectClose(BigFloat(300000000000000000000_Z, 50).log(), "47.150314148549023371755074330609809856669520330398", 50);
+    expectClose(BigFloat(Q(100000000000000000001_Z, 100000000000000000000_N), 50).log(),
+                "0.0000000000000000000099999999999999999999500000000000000000003333333333", 50);
+    // Чуть меньше единицы: без сдвига на 10^-1, иначе log(10 x) - ln 10 теряет первые 20 цифр
+    expectClose(BigFloat(Q(99999999999999999999_Z, 100000000000000000000_N), 50).log(),
+                "-0.000000000000000000010000000000000000000050000000000000000000333333333333", 50);
+    expectClose(BigFloat(Q(95_Z, 100_N), 50).log(), "-0.051293294387550533426196144254687238439222361689899", 50);
+    EXPECT_TRUE(BigFloat(std::int64_t{1}).log().isZero());
+    EXPECT_THROW(BigFloat(std::int64_t{-1}).log(), UniversalStringException);
+}
+
+TEST(BigFloatElementary3, Trigonometry) {
+    expectClose(BigFloat(std::int64_t{1}, 80).sin(), "0.84147098480789650665250232163029899962256306079837106567275170999191040439123967", 80);
+    expectClose(BigFloat(std::int64_t{1}, 80).cos(), "0.54030230586813971740093660744297660373231042061792222767009725538110039477447176", 80);
+    expectClose(BigFloat(std::int64_t{1000000}, 50).sin(), "-0.34999350217129295211765248678077146906140660532872", 50);
+    expectClose(BigFloat(std::int64_t{1}, 50).atan(), "0.78539816339744830961566084581987572104929234984378", 50);
+    expectClose(BigFloat(std::int64_t{-1000}, 30).atan().sin(), "-0.9999995000003749996875002734372539064761", 30);
+    EXPECT_TRUE(BigFloat(std::int64_t{0}).sin().isZero());
+}
+
+// Около кратных pi/2 приведение теряет старшие цифры r, точность приведения должна расти на глубину r
+TEST(BigFloatElementary4, NearMultiplesOfHalfPi) {
+    Q near_pi(314159265358979323846264338_Z, N(NatOper::powerOfTen(26)));
+    Q near_half_pi(157079632679489661923132169_Z, N(NatOper::powerOfTen(26)));
+    Q near_minus_pi(-314159265358979323846264338_Z, N(NatOper::powerOfTen(26)));
+    const std::string sin_near_pi =
+        "0.00000000000000000000000000327950288419716939937510582097494459230781640628620899274944983873895";
+    const std::string cos_near_half_pi =
+        "0.00000000000000000000000000163975144209858469968755291048747229615390820314310449857919428934566";
+    for (std::uint64_t precision : {30u, 60u}) {
+        expectClose(BigFloat(near_pi, precision).sin(), sin_near_pi, precision);
+        expectClose(BigFloat(near_half_pi, precision).cos(), cos_near_half_pi, precision);
+        expectClose(BigFloat(near_minus_pi, precision).sin(), "-" + sin_near_pi, precision);
+    }
+    EXPECT_EQ(BigFloat(near_pi, 30).sin().toString(), "3.27950288419716939937510582097e-27");
+}
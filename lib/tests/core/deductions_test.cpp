@@ -213,4 +213,16 @@ TEST(ZpNeg3, ZeroNegation) {
     auto zero = Zp<5>::zero();
     auto neg_zero = -zero;
     EXPECT_EQ(neg_zero.toString(), "0");
-}
\ No newline at end of file
+}
+// ZP11 - Максимальность идеала проверяется на этапе компиляции
+static_assert(MaximalIdeal<PrincipalIdealZ<7>, Z>);
+static_assert(MaximalIdeal<PrincipalIdealZ<18446744073709551557ULL>, Z>);
+static_assert(!MaximalIdeal<PrincipalIdealZ<4>, Z>);
+static_assert(!MaximalIdeal<PrincipalIdealZ<3215031751>, Z>);   // сильно псевдопростое по основаниям 2, 3, 5, 7
+
+TEST(ZpMaximal1, CompositeModulusIsRing) {
+    FactorRing<Z, PrincipalIdealZ<4>> a(makeZ(3));
+    FactorRing<Z, PrincipalIdealZ<4>> b(makeZ(2));
+    EXPECT_EQ((a * b).toString(), "2");
+    EXPECT_EQ((b * b).toString(), "0");
+}
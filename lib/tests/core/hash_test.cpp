@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <unordered_map>
+#include "core/realization/Hashing/intern.h"
+#include "core/realization/deductionclass/pZ.h"
+
+
+// H1 - Равные значения дают равный хэш
+TEST(HashEqual1, Natural) {
+    std::hash<N> h;
+    EXPECT_EQ(h(123456789012345678901234567890_N), h(123456789012345678901234567890_N));
+    EXPECT_NE(h(123456789012345678901234567890_N), h(123456789012345678901234567891_N));
+    EXPECT_NE(h(0_N), h(1_N));
+}
+
+TEST(HashEqual2, IntegerCanonical) {
+    std::hash<Z> h;
+    Z big = 99999999999999999999_Z;
+    EXPECT_EQ(h(big - 99999999999999999998_Z), h(1_Z));
+    EXPECT_NE(h(big), h(-big));
+    EXPECT_NE(h(5_Z), h(-5_Z));
+}
+
+TEST(HashEqual3, RationalReduced) {
+    std::hash<Q> h;
+    Q half(1_Z, 2_N);
+    Q unreduced(2_Z, 4_N);
+    EXPECT_TRUE(half == unreduced);
+    EXPECT_EQ(h(half), h(unreduced));
+    EXPECT_NE(h(half), h(Q(-1_Z, 2_N)));
+}
+
+// H2 - Хэш запоминается в объекте и переезжает вместе с копией
+TEST(HashCache1, StoredInObject) {
+    N a = 12345678901234567890123_N;
+    EXPECT_EQ(a.get().hash_cache.value, 0u);
+    std::size_t value = std::hash<N>{}(a);
+    EXPECT_EQ(a.get().hash_cache.value, value);
+
+    N copy = a;
+    EXPECT_EQ(copy.get().hash_cache.value, value);
+}
+
+// H3 - Типы можно использовать как ключи
+TEST(HashContainers1, UnorderedMap) {
+    std::unordered_map<Q, int> counts;
+    counts[Q(1_Z, 2_N)] += 1;
+    counts[Q(3_Z, 6_N)] += 1;
+    counts[Q(1_Z, 3_N)] += 1;
+    EXPECT_EQ(counts.size(), 2u);
+    EXPECT_EQ(counts[Q(1_Z, 2_N)], 2);
+}
+
+TEST(HashContainers2, Polynomials) {
+    std::unordered_map<P<Zp<7>>, int> seen;
+    P<Zp<7>> p({Zp<7>(Z(3_Z)), Zp<7>(Z(1_Z))});
+    P<Zp<7>> same({Zp<7>(Z(10_Z)), Zp<7>(Z(8_Z)), Zp<7>(Z(7_Z))});  // 3 + x, старший коэффициент обнулился
+    seen[p] = 1;
+    EXPECT_EQ(seen.count(same), 1u);
+    EXPECT_EQ(std::hash<P<Zp<7>>>{}(p), std::hash<P<Zp<7>>>{}(same));
+}
+
+// H4 - Интернирование
+TEST(Intern1, SharedInstance) {
+    Interned<N> a = intern(314159265358979323846264338327950288_N);
+    Interned<N> b = intern(314159265358979323846264338327950288_N);
+    Interned<N> c = intern(271828182845904523536028747135266249_N);
+    EXPECT_TRUE(a == b);
+    EXPECT_FALSE(a == c);
+    EXPECT_EQ(&a.get(), &b.get());
+    EXPECT_EQ(a->toString(), "314159265358979323846264338327950288");
+}
+
+TEST(Intern2, RationalValues) {
+    Interned<Q> a = intern(Q(1_Z, 2_N));
+    Interned<Q> b = intern(Q(5_Z, 10_N));
+    EXPECT_TRUE(a == b);
+    EXPECT_EQ(std::hash<Interned<Q>>{}(a), std::hash<Q>{}(Q(1_Z, 2_N)));
+}
@@ -118,6 +118,122 @@ TEST(IntegerRem2, ThrowsOnZero) {
     EXPECT_THROW(a % zero, UniversalStringException);
 }
 
+// Операции с машинным словом
+TEST(IntegerWordOps1, Construct) {
+    EXPECT_EQ(Z(std::int64_t{-123}).toString(), "-123");
+    EXPECT_EQ(Z(INT64_MIN).toString(), "-9223372036854775808");
+    EXPECT_EQ(Z(INT64_MIN).toInt64(), INT64_MIN);
+    EXPECT_FALSE(Z(INT64_MIN).mulUi(2).fitsInt64());
+    EXPECT_THROW(Z(std::int64_t{-1}).toUInt64(), UniversalStringException);
+}
+
+TEST(IntegerWordOps2, AddMul) {
+    EXPECT_EQ(Z(std::int64_t{-100}).addUi(30).toString(), "-70");
+    EXPECT_EQ(Z(std::int64_t{-100}).addUi(100).toString(), "0");
+    EXPECT_EQ(Z(std::int64_t{-100}).addUi(130).toString(), "30");
+    EXPECT_EQ(Z(std::int64_t{-7}).mulUi(6).toString(), "-42");
+}
+
+TEST(IntegerWordOps3, DivModFloor) {
+    auto [q1, r1] = Z(std::int64_t{7}).divmodUi(2);
+    EXPECT_EQ(q1.toString(), "3");
+    EXPECT_EQ(r1, 1u);
+
+    auto [q2, r2] = Z(std::int64_t{-7}).divmodUi(2);
+    EXPECT_EQ(q2.toString(), "-4");
+    EXPECT_EQ(r2, 1u);
+
+    auto [q3, r3] = Z(std::int64_t{-8}).divmodUi(2);
+    EXPECT_EQ(q3.toString(), "-4");
+    EXPECT_EQ(r3, 0u);
+
+    EXPECT_EQ(Z(std::int64_t{-5}).cmpUi(0), 1);
+    EXPECT_EQ(Z(std::int64_t{5}).cmpUi(5), 0);
+}
+
+// Малое представление: переход в длинную арифметику при переполнении и обратно
+TEST(IntegerSmall1, OverflowPromotion) {
+    Z max(INT64_MAX);
+    Z one(std::int64_t{1});
+    EXPECT_EQ((max + one).toString(), "9223372036854775808");
+    EXPECT_EQ((-max - one - one).toString(), "-9223372036854775809");
+    EXPECT_EQ((max * max).toString(), "85070591730234615847396907784232501249");
+    EXPECT_EQ(((max + one) - one).toString(), "9223372036854775807");
+    EXPECT_TRUE(((max + one) - one).get().is_small);
+    EXPECT_FALSE((max + one).get().is_small);
+}
+
+TEST(IntegerSmall2, MinValue) {
+    Z min(INT64_MIN);
+    EXPECT_FALSE(min.get().is_small);
+    EXPECT_EQ((-min).toString(), "9223372036854775808");
+    EXPECT_EQ((min + Z(std::int64_t{1})).get().small, INT64_MIN + 1);
+    EXPECT_EQ((min / Z(std::int64_t{-1})).toString(), "9223372036854775808");
+}
+
+TEST(IntegerSmall3, MixedCompare) {
+    Z big(Natural({0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}), false);  // 10^20
+    Z small(std::int64_t{-5});
+    EXPECT_TRUE(big > small);
+    EXPECT_TRUE(-big < small);
+    EXPECT_TRUE(Z(std::int64_t{3}) < big);
+    EXPECT_EQ(Int::Cmp::execute(big.get(), big.get()), 0);
+    EXPECT_EQ((Z(std::int64_t{-7}) % Z(std::int64_t{3})).toString(), "2");
+    EXPECT_EQ((Z(std::int64_t{-7}) / Z(std::int64_t{2})).toString(), "-3");
+}
+
+// Литералы и вычисления на этапе компиляции
+static_assert((-5_Z).isNegative());
+static_assert((-5_Z + 5_Z).isZero());
+static_assert((-7_Z) * 6_Z == -42_Z);
+static_assert((99999999999999999999_Z - 99999999999999999998_Z).isOne());
+
+TEST(IntegerLiterals1, Basic) {
+    EXPECT_EQ((-5_Z).toString(), "-5");
+    EXPECT_EQ((100000000000000000000_Z).toString(), "100000000000000000000");
+    EXPECT_TRUE(Z::zero().isZero());
+    EXPECT_TRUE(Z::identity().isOne());
+}
+
+// Корни и полные степени
+TEST(IntegerRoots1, Basic) {
+    EXPECT_EQ((17_Z).isqrt(), 4_Z);
+    EXPECT_EQ((-27_Z).iroot(3), -3_Z);
+    EXPECT_EQ((-30_Z).iroot(3), -3_Z);
+    EXPECT_THROW((-4_Z).isqrt(), UniversalStringException);
+    EXPECT_THROW((-16_Z).iroot(4), UniversalStringException);
+    EXPECT_EQ((-2_Z).powUi(63), -9223372036854775808_Z);
+    EXPECT_EQ((-2_Z).powUi(64), 18446744073709551616_Z);
+}
+
+TEST(IntegerRoots2, PerfectPowers) {
+    EXPECT_TRUE((144_Z).isPerfectSquare());
+    EXPECT_FALSE((-144_Z).isPerfectSquare());
+
+    auto [root, exponent] = (-64_Z).perfectPower();
+    EXPECT_EQ(root, -4_Z);
+    EXPECT_EQ(exponent, 3u);
+    EXPECT_FALSE((-16_Z).isPerfectPower());
+    EXPECT_TRUE((-32_Z).isPerfectPower());
+}
+
+// Комбинаторика
+TEST(IntegerCombinatorics1, NegativeArguments) {
+    EXPECT_EQ(Z::binomial(-5_Z, 3), -35_Z);
+    EXPECT_EQ(Z::binomial(-5_Z, 2), 15_Z);
+    EXPECT_EQ(Z::binomial(6_Z, 2), 15_Z);
+    EXPECT_EQ((-3_Z).fallingFactorial(2), 12_Z);
+    EXPECT_EQ((-3_Z).risingFactorial(2), 6_Z);
+    EXPECT_EQ((-3_Z).risingFactorial(4), 0_Z);
+    EXPECT_EQ(Z::factorial(5), 120_Z);
+}
+
+TEST(IntegerPrimality1, Sign) {
+    EXPECT_TRUE((7_Z).isProbablePrime());
+    EXPECT_FALSE((-7_Z).isProbablePrime());
+    EXPECT_TRUE((-618970019642690137449562111_Z * -1_Z).isProbablePrime());
+}
+
 TEST(RingTestInteger, bas5) {
 	bool res = UnitaryRing<Z::SetType, Z::AdditionOp, Z::MultiplicationOp>;
 
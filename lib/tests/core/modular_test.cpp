@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "core/realization/Modular/crt.h"
+
+
+// M1 - Обратный по модулю
+TEST(ModularInverse1, Basic) {
+    EXPECT_EQ(Modular::invModWord(3, 7), 5u);
+    EXPECT_EQ(Modular::invModWord(6, 9), 0u);
+
+    N m = 170141183460469231731687303715884105727_N;   // 2^127 - 1
+    std::optional<Natural> inv = Modular::InvMod::execute((123456789_N).get(), m.get());
+    ASSERT_TRUE(inv.has_value());
+    EXPECT_TRUE((N(*inv) * 123456789_N % m).isOne());
+    EXPECT_FALSE(Modular::InvMod::execute((6_N).get(), (9_N).get()).has_value());
+}
+
+// M2 - CRT по дереву произведений
+TEST(Crt1, Combine) {
+    Modular::CrtBasis basis = Modular::CrtBasis::fromWords({3, 5, 7, 11, 13});
+    EXPECT_EQ(basis.modulus(), 15015_N);
+    EXPECT_EQ(basis.combine(std::vector<std::uint64_t>{2, 3, 2, 0, 1}), 11363_N);
+    EXPECT_EQ(basis.combineSymmetric(std::vector<std::uint64_t>{2, 4, 6, 10, 12}), -1_Z);
+    EXPECT_THROW(Modular::CrtBasis::fromWords({4, 6}), UniversalStringException);
+}
+
+TEST(Crt2, BigModuli) {
+    std::vector<std::uint64_t> primes = Primes::crtPrimes(5);
+    Modular::CrtBasis basis = Modular::CrtBasis::fromWords(primes);
+    Z x = -123456789012345678901234567890123456789012345678901234567890_Z;
+    std::vector<std::uint64_t> residues;
+    for (std::uint64_t p : primes) residues.push_back(x.divmodUi(p).second);
+    EXPECT_EQ(basis.combineSymmetric(residues), x);
+}
+
+// M3 - Восстановление дробей
+TEST(RationalReconstruction1, Wang) {
+    N m = 170141183460469231731687303715884105727_N;
+    Q value(-1234567_Z, 7654321_N);
+    N u = N(Modular::InvMod::execute((7654321_N).get(), m.get()).value()) * (m - 1234567_N) % m;
+    N bound = (m / 2_N).isqrt();
+    std::optional<Rational> back = Modular::RationalReconstruction::execute(u.get(), m.get(), bound.get(), bound.get());
+    ASSERT_TRUE(back.has_value());
+    EXPECT_EQ(Q(*back), value);
+
+    // Слишком тесные границы - ответа нет
+    EXPECT_FALSE(Modular::RationalReconstruction::execute(u.get(), m.get(), (1000_N).get(), (1000_N).get()).has_value());
+}
+
+TEST(RationalReconstruction2, EarlyTermination) {
+    Q value(-123456789123456789_Z, 987654321987654322_N);
+    Modular::CrtLifter lifter;
+    std::size_t used = 0;
+    for (std::uint64_t p : Primes::crtPrimes(10)) {
+        ++used;
+        if (lifter.addImage(p, Modular::reduce(value, p))) break;
+    }
+    ASSERT_TRUE(lifter.reconstruct().has_value());
+    EXPECT_EQ(*lifter.reconstruct(), value);
+    EXPECT_LT(used, 10u);
+    EXPECT_EQ(Modular::reduce(value, 7), Modular::reduce(*lifter.reconstruct(), 7));
+}
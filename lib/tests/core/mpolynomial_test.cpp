@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "core/realization/MultiPolynomial/MP[x].h"
+
+#include "core/realization/Rational/Q.h"
+#include "core/realization/deductionclass/pZ.h"
+
+namespace {
+
+Q q(std::int64_t num) {
+    return Q(num);
+}
+
+template<typename Order>
+MPoly<Q, Order> sumOfVariables(std::size_t n) {
+    MPoly<Q, Order> sum = MPoly<Q, Order>::identity(n);
+    for (std::size_t k = 0; k < n; ++k) sum = sum + MPoly<Q, Order>::variable(n, k);
+    return sum;
+}
+
+}
+
+// Мономиальные порядки: x1*x3^2 и x2^3 одной степени, x1 и x2^5 - разной
+TEST(MPolyOrder1, LexGrlexGrevlex) {
+    std::vector<MultiTerm<Q>> terms = {{{1, 0, 2}, q(1)}, {{0, 3, 0}, q(1)}, {{1, 0, 0}, q(1)}, {{0, 5, 0}, q(1)}};
+    EXPECT_EQ((MPoly<Q, MonomialOrder::Lex>(3, terms).toString()), "x1*x3^2 + x1 + x2^5 + x2^3");
+    EXPECT_EQ((MPoly<Q, MonomialOrder::GrLex>(3, terms).toString()), "x2^5 + x1*x3^2 + x2^3 + x1");
+    EXPECT_EQ((MPoly<Q, MonomialOrder::GrevLex>(3, terms).toString()), "x2^5 + x2^3 + x1*x3^2 + x1");
+
+    // Одинаковые мономы складываются, нули пропадают
+    MPoly<Q> f(2, {{{1, 1}, q(2)}, {{0, 0}, q(-3)}, {{1, 1}, q(-2)}, {{2, 0}, q(0)}});
+    EXPECT_EQ(f.size(), 1u);
+    EXPECT_EQ(f.toString(), "-3/1");
+    EXPECT_THROW(MPoly<Q>(2, {{{1}, q(1)}}), UniversalStringException);
+}
+
+// Умножение кучей: (1 + x1 + ... + xn)^d имеет C(n + d, d) членов
+TEST(MPolyMul1, Expansion) {
+    using R = MPoly<Q, MonomialOrder::GrevLex>;
+    R s = sumOfVariables<MonomialOrder::GrevLex>(5);
+    R f = s * s * s * s;
+    EXPECT_EQ(f.size(), 126u);
+    EXPECT_EQ(f.degree(), 4u);
+
+    std::vector<Q> point = {q(1), q(-2), q(3), Q(1_Z, 2_N), q(0)};
+    Q value = s.evaluate(point);
+    EXPECT_TRUE(f.evaluate(point) == value * value * value * value);
+
+    R g = f * s - s * f;
+    EXPECT_EQ(g.size(), 0u);
+    EXPECT_TRUE((f + s) - s == f);
+    EXPECT_TRUE(f * R::zero(5) == R::zero(5));
+    EXPECT_TRUE(f * R::identity(5) == f);
+    EXPECT_THROW(f + R::identity(4), UniversalStringException);
+
+    // Тот же результат в другом порядке
+    using L = MPoly<Q, MonomialOrder::Lex>;
+    L sl = sumOfVariables<MonomialOrder::Lex>(5);
+    L fl = sl * sl * sl * sl;
+    EXPECT_EQ(fl.size(), 126u);
+    EXPECT_TRUE(fl.evaluate(point) == f.evaluate(point));
+    EXPECT_EQ(fl.terms().front().exponents, (std::vector<std::uint64_t>{4, 0, 0, 0, 0}));
+}
+
+// Переполнение упакованного поля: моном перепаковывается в поля шире
+TEST(MPolyMul2, ExponentOverflow) {
+    using R = MPoly<Q, MonomialOrder::GrLex>;
+    R a(2, {{{100, 1}, q(1)}, {{0, 0}, q(1)}});   // 8-битные поля: показатели до 127
+    R b(2, {{{100, 0}, q(2)}, {{0, 3}, q(-1)}});
+    R c = a * b;
+    std::vector<MultiTerm<Q>> terms = c.terms();
+    ASSERT_EQ(terms.size(), 4u);
+    EXPECT_EQ(terms[0].exponents, (std::vector<std::uint64_t>{200, 1}));
+    EXPECT_EQ(c.degree(), 201u);
+    EXPECT_TRUE(c == R(2, {{{200, 1}, q(2)}, {{100, 4}, q(-1)}, {{100, 0}, q(2)}, {{0, 3}, q(-1)}}));
+
+    R big(2, {{{std::uint64_t{1} << 40, 0}, q(1)}});
+    EXPECT_EQ((big * big).degree(), std::uint64_t{1} << 41);
+    R huge(2, {{{std::uint64_t{1} << 62, 0}, q(1)}});
+    EXPECT_THROW(huge * huge, UniversalStringException);
+}
+
+// Много переменных и коэффициенты в Zp
+TEST(MPolyMul3, ManyVariablesZp) {
+    constexpr size_t p = 1000003;
+    using R = MPoly<Zp<p>>;
+    const std::size_t n = 20;
+    Zp<p> one = Zp<p>::identity();
+    R s = R::identity(n);
+    for (std::size_t k = 0; k < n; ++k) s = s + R::variable(n, k) * Zp<p>(Z(std::int64_t(k + 2)));
+    R f = s * s * s;
+    EXPECT_EQ(f.size(), 1771u);   // C(23, 3)
+
+    std::vector<Zp<p>> point;
+    for (std::size_t k = 0; k < n; ++k) point.push_back(Zp<p>(Z(std::int64_t(7 * k + 1))));
+    Zp<p> value = s.evaluate(point);
+    EXPECT_TRUE(f.evaluate(point) == value * value * value);
+    EXPECT_TRUE((f * s).evaluate(point) == value * value * value * value);
+    EXPECT_TRUE(R::constant(n, one) == R::identity(n));
+}
+
+TEST(MPolyStructure1, IsRing) {
+    static_assert(Ring<MPoly<Q>::SetType, MPoly<Q>::AdditionOp, MPoly<Q>::MultiplicationOp>,
+                  "MPoly<Q> must be a ring!");
+    EXPECT_TRUE(true);
+}
@@ -89,6 +89,180 @@ TEST(NaturalExtra1, EdgeCases) {
     EXPECT_THROW(fromStr("10") / fromStr("0"), UniversalStringException);
 }
 
+// Операции с машинным словом
+TEST(NaturalWordOps1, AddMul) {
+    N a = fromStr("99999999999999999999");
+    EXPECT_EQ(a.addUi(1).toString(), "100000000000000000000");
+    EXPECT_EQ(a.addUi(UINT64_MAX).toString(), "118446744073709551614");
+    EXPECT_EQ(fromStr("123").mulUi(1000000007).toString(), "123000000861");
+    EXPECT_EQ(fromStr("123").mulUi(0).toString(), "0");
+}
+
+TEST(NaturalWordOps2, DivModCmp) {
+    auto [q, r] = fromStr("123456789012345678901234567890").divmodUi(1000000007);
+    EXPECT_EQ(q.toString(), "123456788148148161864");
+    EXPECT_EQ(r, 197434842u);
+    EXPECT_THROW(fromStr("10").divmodUi(0), UniversalStringException);
+
+    EXPECT_EQ(fromStr("18446744073709551615").cmpUi(UINT64_MAX), 0);
+    EXPECT_EQ(fromStr("18446744073709551616").cmpUi(UINT64_MAX), 2);
+    EXPECT_EQ(fromStr("41").cmpUi(42), 1);
+}
+
+TEST(NaturalWordOps3, Conversions) {
+    EXPECT_EQ(N(std::uint64_t{0}).toString(), "0");
+    EXPECT_EQ(N(UINT64_MAX).toUInt64(), UINT64_MAX);
+    EXPECT_FALSE(fromStr("18446744073709551616").fitsUInt64());
+    EXPECT_THROW(fromStr("18446744073709551616").toUInt64(), UniversalStringException);
+    EXPECT_THROW(N(UINT64_MAX).toInt64(), UniversalStringException);
+    EXPECT_EQ(N(std::uint64_t{42}).toInt64(), 42);
+}
+
+TEST(NaturalWordOps4, Radix) {
+    N a = fromStr("255");
+    EXPECT_EQ(a.toRadix(2), (std::vector<std::uint64_t>{1, 1, 1, 1, 1, 1, 1, 1}));
+    EXPECT_EQ(a.toRadix(16), (std::vector<std::uint64_t>{15, 15}));
+    EXPECT_EQ(fromStr("0").toRadix(7), (std::vector<std::uint64_t>{0}));
+
+    N big = fromStr("340282366920938463463374607431768211457");
+    EXPECT_EQ(N::fromRadix(big.toRadix(UINT64_MAX), UINT64_MAX).toString(), big.toString());
+    EXPECT_THROW(N::fromRadix({2}, 2), UniversalStringException);
+}
+
+// Литералы и вычисления на этапе компиляции
+static_assert((123_N).get().nums.size() == 3);
+static_assert((0_N).isZero() && !(10_N).isZero());
+static_assert((1_N).isOne() && !(11_N).isOne());
+static_assert(N::gcd(48_N, 18_N) == 6_N);
+static_assert((1'000'000_N) / 1000_N == 1000_N);
+
+TEST(NaturalLiterals1, Basic) {
+    EXPECT_EQ((123456789012345678901234567890_N).toString(), "123456789012345678901234567890");
+    EXPECT_EQ((97_N + 25_N).toString(), "122");
+    EXPECT_TRUE(N::zero().isZero());
+    EXPECT_TRUE(N::identity().isOne());
+    EXPECT_EQ(&N::zero(), &N::zero());
+}
+
+// Корни и полные степени
+TEST(NaturalRoots1, ISqrt) {
+    EXPECT_EQ((0_N).isqrt(), 0_N);
+    EXPECT_EQ((15_N).isqrt(), 3_N);
+    EXPECT_EQ((16_N).isqrt(), 4_N);
+    EXPECT_EQ(N(UINT64_MAX).isqrt(), 4294967295_N);
+    EXPECT_EQ((200000000000000000000000000000000000000000000000000_N).isqrt(), 14142135623730950488016887_N);
+    EXPECT_EQ((10000000000000000000000000000000000012345_N).isqrt(), 100000000000000000000_N);
+}
+
+TEST(NaturalRoots2, IRoot) {
+    N x = 123456789012345678901_N;
+    N cube = 1881676372353657772535990485684393532449643155190439821666701_N;
+    EXPECT_EQ(cube.iroot(3), x);
+    EXPECT_EQ((cube - 1_N).iroot(3), x - 1_N);
+    EXPECT_EQ((1000_N).iroot(3), 10_N);
+    EXPECT_EQ((999_N).iroot(3), 9_N);
+    EXPECT_EQ((12345678901234567890123_N).iroot(200), 1_N);
+    EXPECT_EQ((7_N).powUi(60), 508021860739623365322188197652216501772434524836001_N);
+    EXPECT_THROW((8_N).iroot(0), UniversalStringException);
+}
+
+TEST(NaturalRoots3, PerfectPowers) {
+    EXPECT_TRUE((15241578753238836750437433565526596567801_N).isPerfectSquare());
+    EXPECT_FALSE((15241578753238836750437433565526596567802_N).isPerfectSquare());
+    EXPECT_FALSE((2_N).isPerfectPower());
+    EXPECT_TRUE((1024_N).isPerfectPower());
+
+    auto [root, exponent] = (7_N).powUi(60).perfectPower();
+    EXPECT_EQ(root, 7_N);
+    EXPECT_EQ(exponent, 60u);
+
+    auto [root2, exponent2] = (12157665459056928801_N).perfectPower();  // 3^40
+    EXPECT_EQ(root2, 3_N);
+    EXPECT_EQ(exponent2, 40u);
+    EXPECT_EQ((72_N).perfectPower().second, 1u);
+}
+
+// Комбинаторика
+TEST(NaturalCombinatorics1, Factorial) {
+    EXPECT_EQ(N::factorial(0), 1_N);
+    EXPECT_EQ(N::factorial(20), 2432902008176640000_N);
+    EXPECT_EQ(N::factorial(30), 265252859812191058636308480000000_N);
+
+    N naive = 1_N;
+    for (std::uint64_t i = 2; i <= 300; ++i) naive = naive.mulUi(i);
+    EXPECT_EQ(N::factorial(300), naive);
+
+    N big = N::factorial(5000);
+    EXPECT_EQ(big.toString().size(), 16326u);
+    EXPECT_EQ(big.divmodUi(1000000007).second, 541108809u);
+}
+
+TEST(NaturalCombinatorics2, Binomial) {
+    EXPECT_EQ(N::binomial(100_N, 50), 100891344545564193334812497256_N);
+    EXPECT_EQ(N::binomial(5_N, 7), 0_N);
+    EXPECT_EQ(N::binomial(5_N, 0), 1_N);
+    EXPECT_EQ(N::binomial(3000_N, 1234).divmodUi(1000000007).second, 789927389u);
+    EXPECT_EQ(N::binomial(100000000000000000000_N, 3), 166666666666666666661666666666666666666700000000000000000000_N);
+    EXPECT_EQ(N::multinomial({2, 3, 5}), 2520_N);
+    EXPECT_EQ(N::multinomial({20, 20, 20}), 577831214478475823831865900_N);
+}
+
+// Вне решета: симметрия C(n, k) = C(n, n - k) и сокращение наибольшего k_i в мультиномиальном
+TEST(NaturalCombinatorics4, BeyondSieve) {
+    EXPECT_EQ(N::binomial(1073741824_N, 1073741823), 1073741824_N);             // 2^30
+    EXPECT_EQ(N::binomial(1073741824_N, 1073741822), 576460751766552576_N);
+    EXPECT_EQ(N::binomial(1099511627776_N, 3), 221537999296881515907494228629913600_N);   // 2^40
+    EXPECT_EQ(N::multinomial({1000000000000, 1}), 1000000000001_N);
+    EXPECT_EQ(N::multinomial({2, 1000000000000, 3}), 83333333334583333333340416666666685416666666689500000000010_N);
+    EXPECT_EQ(N::multinomial({0, 1000000000000}), 1_N);
+}
+
+TEST(NaturalCombinatorics3, RisingFalling) {
+    N n = 12345678901234567890123_N;
+    EXPECT_EQ(n.risingFactorial(3), 1881676372353657772546964422386725494909979428345081403294263936500_N);
+    EXPECT_EQ((10_N).fallingFactorial(3), 720_N);
+    EXPECT_EQ((2_N).fallingFactorial(3), 0_N);
+    EXPECT_EQ((7_N).risingFactorial(0), 1_N);
+    EXPECT_EQ(N::product({2_N, 3_N, 5_N, 7_N}), 210_N);
+    EXPECT_EQ(n.sqr(), n * n);
+}
+
+// Простота
+TEST(NaturalPrimality1, Words) {
+    EXPECT_FALSE((0_N).isProbablePrime());
+    EXPECT_FALSE((1_N).isProbablePrime());
+    EXPECT_TRUE((2_N).isProbablePrime());
+    EXPECT_FALSE((2817_N).isProbablePrime());        // 3 * 939
+    EXPECT_TRUE((2819_N).isProbablePrime());
+    EXPECT_FALSE((561_N).isProbablePrime());         // число Кармайкла
+    EXPECT_FALSE((3215031751_N).isProbablePrime());
+    EXPECT_FALSE((3825123056546413051_N).isProbablePrime());
+    EXPECT_TRUE((18446744073709551557_N).isProbablePrime());
+    EXPECT_FALSE((18446744073709551615_N).isProbablePrime());
+}
+
+TEST(NaturalPrimality2, BigNumbers) {
+    EXPECT_TRUE((618970019642690137449562111_N).isProbablePrime());                   // 2^89 - 1
+    EXPECT_TRUE((170141183460469231731687303715884105727_N).isProbablePrime());       // 2^127 - 1
+    EXPECT_FALSE((1427247692705959880439315947500961989719490561_N).isProbablePrime()); // (2^61 - 1)(2^89 - 1)
+    EXPECT_FALSE((170141183460469231731687303715884105727_N * 3_N).isProbablePrime());
+    EXPECT_FALSE((618970019642690137449562111_N).sqr().isProbablePrime());
+}
+
+TEST(NaturalPrimality3, Components) {
+    // 2047 = 23 * 89 проходит Миллера-Рабина по основанию 2, 5777 = 53 * 109 - сильно псевдопростое по Люку
+    EXPECT_TRUE(NatOper::MillerRabin::execute(Natural(std::uint64_t{2047}), Natural(std::uint64_t{2})));
+    EXPECT_FALSE(NatOper::MillerRabin::execute(Natural(std::uint64_t{5777}), Natural(std::uint64_t{2})));
+    EXPECT_TRUE(NatOper::StrongLucas::execute(Natural(std::uint64_t{5777})));
+    EXPECT_FALSE(NatOper::StrongLucas::execute(Natural(std::uint64_t{2047})));
+    EXPECT_EQ((3_N).powMod(100000000000000000001_N, 618970019642690137449562111_N), 275674416512046077047424450_N);
+}
+
+static_assert(NatOper::isPrimeWord(1000000007));
+static_assert(!NatOper::isPrimeWord(1000000007ULL * 998244353ULL));
+
+static_assert((1000000_N).isqrt() == 1000_N);
+
 TEST(RingTestNaturel, baseN) {
 	bool res = Ring<N::SetType, N::AdditionOp, N::MultiplicationOp>;
 	EXPECT_EQ(res, false);
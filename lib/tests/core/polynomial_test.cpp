@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 #include "core/realization/Polynomial/P[x].h"
+#include "core/realization/Polynomial/SP[x].h"
 
 #include "core/realization/Rational/Q.h"
+#include "core/realization/deductionclass/pZ.h"
 
 // Хелпер для создания Q
 Q makeQ(int num, int den = 1) {
@@ -105,6 +107,312 @@ TEST(PolynomMul1, Basic) {
     EXPECT_EQ(result[2].toString(), "1/1");
 }
 
+// Карацуба: сверяем с умножением столбиком на длинных множителях разной длины
+TEST(PolynomMul2, Karatsuba) {
+    // Специализация порога должна находиться для ::Q, а не для объявленного внутри Poly класса
+    static_assert(Poly::KaratsubaThreshold<::Q>::value == 48, "Q must use its own Karatsuba threshold!");
+    static_assert(Poly::KaratsubaThreshold<Zp<7>>::value == 32, "Zp must use the default Karatsuba threshold!");
+    std::vector<Q> a, b;
+    for (int i = 0; i < 150; ++i) a.push_back(makeQ(i % 7 - 3, i % 5 + 1));
+    for (int i = 0; i < 90; ++i) b.push_back(makeQ(i % 11 - 5, 2));
+    std::vector<Q> expected(a.size() + b.size() - 1, Q::zero());
+    for (size_t i = 0; i < a.size(); ++i)
+        for (size_t j = 0; j < b.size(); ++j) expected[i + j] = expected[i + j] + a[i] * b[j];
+
+    P<Q> result = P<Q>(a) * P<Q>(b);
+    ASSERT_EQ(result.degree(), expected.size() - 1);
+    for (size_t i = 0; i < expected.size(); ++i) EXPECT_TRUE(result[i] == expected[i]);
+
+    // Сильно разные длины: длинный множитель режется на куски
+    std::vector<Q> c(40, makeQ(1));
+    P<Q> chunked = P<Q>(a) * P<Q>(c);
+    ASSERT_EQ(chunked.degree(), 188u);
+    Q prefix = Q::zero();
+    for (size_t i = 0; i < 40; ++i) prefix = prefix + a[i];
+    EXPECT_TRUE(chunked[39] == prefix);
+    Q middle = Q::zero();
+    for (size_t i = 61; i <= 100; ++i) middle = middle + a[i];
+    EXPECT_TRUE(chunked[100] == middle);
+}
+
+TEST(PolynomMul3, KaratsubaZp) {
+    // (1 + x + ... + x^199)(1 - x) = 1 - x^200 над Z/7
+    std::vector<Zp<7>> ones(200, Zp<7>::identity());
+    P<Zp<7>> geometric(ones);
+    P<Zp<7>> factor({Zp<7>::identity(), -Zp<7>::identity()});
+    P<Zp<7>> result = geometric * factor;
+    EXPECT_EQ(result.degree(), 200u);
+    EXPECT_TRUE(result[0] == Zp<7>::identity());
+    EXPECT_TRUE(result[200] == -Zp<7>::identity());
+    for (size_t i = 1; i < 200; ++i) EXPECT_TRUE(result[i] == Zp<7>::zero());
+
+    P<Zp<7>> square = geometric * geometric;
+    EXPECT_EQ(square.degree(), 398u);
+    EXPECT_TRUE(square[199] == Zp<7>(Z(std::int64_t{200})));
+    EXPECT_TRUE(square[300] == Zp<7>(Z(std::int64_t{99})));
+}
+
+// NTT: сверяем с Карацубой по модулю, удобному для NTT, и по модулям, где нужен CRT трех простых
+template<size_t p>
+std::vector<Zp<p>> pseudoRandomZp(size_t count, std::uint64_t seed) {
+    std::vector<Zp<p>> coeffs;
+    for (size_t i = 0; i < count; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        coeffs.push_back(Zp<p>(Z(N(seed >> 1))));
+    }
+    return coeffs;
+}
+
+template<size_t p>
+void expectNttMatchesKaratsuba(size_t n, size_t m) {
+    std::vector<Zp<p>> a = pseudoRandomZp<p>(n, 1), b = pseudoRandomZp<p>(m, 2);
+    std::vector<Zp<p>> expected(n + m - 1, Zp<p>::zero());
+    Poly::mulInto<Zp<p>>(a, b, expected);
+    P<Zp<p>> result = P<Zp<p>>(a) * P<Zp<p>>(b);
+    ASSERT_EQ(result.degree(), n + m - 2);
+    for (size_t i = 0; i < expected.size(); ++i) EXPECT_TRUE(result[i] == expected[i]) << i;
+}
+
+TEST(PolynomNtt1, Multiply) {
+    expectNttMatchesKaratsuba<998244353>(300, 170);
+    expectNttMatchesKaratsuba<1000003>(257, 64);                  // p - 1 = 2 * 500001
+    expectNttMatchesKaratsuba<2305843009213693951>(200, 200);     // 2^61 - 1
+}
+
+// Модули больше 2^63: сумма двух вычетов не помещается в слово
+TEST(PolynomNtt3, LargeModulus) {
+    expectNttMatchesKaratsuba<18446744069414584321ULL>(64, 64);   // 2^64 - 2^32 + 1, прямое NTT
+    expectNttMatchesKaratsuba<18446744073709551557ULL>(64, 64);   // 2^64 - 59, через CRT
+}
+
+TEST(PolynomNtt2, LowMiddleFixed) {
+    constexpr size_t p = 998244353;
+    Polynomial<Zp<p>> a(pseudoRandomZp<p>(120, 3)), b(pseudoRandomZp<p>(50, 4));
+    P<Zp<p>> full = P<Zp<p>>(a) * P<Zp<p>>(b);
+
+    Polynomial<Zp<p>> low = Ntt::MulLow<p>::execute(a, b, 60);
+    ASSERT_EQ(low.coefficients.size(), 60u);
+    for (size_t i = 0; i < 60; ++i) EXPECT_TRUE(low.coefficients[i] == full[i]);
+
+    // len(a) = n + m - 1 при m = 50: коэффициенты 49..119
+    Polynomial<Zp<p>> middle = Ntt::MulMiddle<p>::execute(a, b, 50, 71);
+    ASSERT_EQ(middle.coefficients.size(), 71u);
+    for (size_t i = 0; i < 71; ++i) EXPECT_TRUE(middle.coefficients[i] == full[i + 49]);
+    EXPECT_THROW(Ntt::MulMiddle<p>::execute(b, a, 50, 71), UniversalStringException);
+    EXPECT_THROW(Ntt::MulMiddle<p>::execute(a, b, 50, 70), UniversalStringException);
+
+    // У a старшие коэффициенты нулевые: длина берется из n, а не из обрезанного полинома
+    std::vector<Zp<p>> short_a = pseudoRandomZp<p>(100, 6);
+    Polynomial<Zp<p>> padded(short_a);
+    P<Zp<p>> short_full = P<Zp<p>>(padded) * P<Zp<p>>(b);
+    Polynomial<Zp<p>> short_middle = Ntt::MulMiddle<p>::execute(padded, b, 50, 71);
+    ASSERT_EQ(short_middle.coefficients.size(), 71u);
+    for (size_t i = 0; i < 71; ++i) EXPECT_TRUE(short_middle.coefficients[i] == short_full[i + 49]) << i;
+
+    Ntt::FixedMultiplier<p> by_b(b);
+    EXPECT_TRUE(P<Zp<p>>(by_b.multiply(a)) == full);
+    Polynomial<Zp<p>> c(pseudoRandomZp<p>(90, 5));
+    EXPECT_TRUE(P<Zp<p>>(by_b.multiply(c)) == P<Zp<p>>(c) * P<Zp<p>>(b));
+}
+
+// Подстановка Кронекера: знаки, знаменатели и откат к Карацубе при разреженной упаковке
+TEST(PolynomKronecker1, MulInteger) {
+    // (1 - 2x + 3x^2)(-4 + 5x) = -4 + 13x - 22x^2 + 15x^3
+    std::vector<Z> product = Kronecker::MulInteger::execute({Z(std::int64_t{1}), Z(std::int64_t{-2}), Z(std::int64_t{3})},
+                                                            {Z(std::int64_t{-4}), Z(std::int64_t{5})});
+    std::vector<std::string> shown;
+    for (const Z& c : product) shown.push_back(c.toString());
+    EXPECT_EQ(shown, (std::vector<std::string>{"-4", "13", "-22", "15"}));
+
+    // Коэффициенты на границе слота: 99..9 и -99..9
+    std::vector<Z> big = {Z(std::int64_t{-999999999}), Z(std::int64_t{999999999}), Z(std::int64_t{0}), Z(std::int64_t{-1})};
+    std::vector<Z> squared = Kronecker::MulInteger::execute(big, big);
+    std::vector<Q> as_q;
+    for (const Z& c : big) as_q.push_back(Q(c, N(std::uint64_t{1})));
+    std::vector<Q> expected(7, Q::zero());
+    Poly::mulInto<Q>(as_q, as_q, expected);
+    for (size_t i = 0; i < 7; ++i) EXPECT_TRUE(Q(squared[i], N(std::uint64_t{1})) == expected[i]) << i;
+}
+
+TEST(PolynomKronecker2, Rational) {
+    std::vector<Q> a, b;
+    for (int i = 0; i < 70; ++i) a.push_back(makeQ((i * 37) % 101 - 50, i % 6 + 1));
+    for (int i = 0; i < 45; ++i) b.push_back(makeQ((i * 53) % 97 - 48, i % 4 + 1));
+    std::vector<Q> expected(a.size() + b.size() - 1, Q::zero());
+    Poly::mulInto<Q>(a, b, expected);
+
+    ASSERT_TRUE(Poly::TransformMul<Q>::preferred(a, b));
+    P<Q> result = P<Q>(a) * P<Q>(b);
+    ASSERT_EQ(result.degree(), expected.size() - 1);
+    for (size_t i = 0; i < expected.size(); ++i) EXPECT_TRUE(result[i] == expected[i]) << i;
+
+    // Один огромный коэффициент: упаковка разрежена, умножение идет Карацубой
+    std::vector<Q> sparse = b;
+    sparse[0] = Q(Z(Natural(std::vector<uint8_t>(400, 7))), N(std::uint64_t{1}));
+    std::vector<Q> expected_sparse(a.size() + sparse.size() - 1, Q::zero());
+    Poly::mulInto<Q>(a, sparse, expected_sparse);
+    P<Q> sparse_result = P<Q>(a) * P<Q>(sparse);
+    for (size_t i = 0; i < expected_sparse.size(); ++i) EXPECT_TRUE(sparse_result[i] == expected_sparse[i]) << i;
+}
+
+// Деление через обратный ряд: проверяем a = q b + r, deg r < deg b
+template<typename T>
+void expectDivision(const P<T>& a, const P<T>& b, const P<T>& q, const P<T>& r) {
+    EXPECT_TRUE(q * b + r == a);
+    EXPECT_TRUE(r == P<T>::zero() || r.degree() < b.degree());
+}
+
+TEST(PolynomNewtonDiv1, Zp) {
+    constexpr size_t p = 998244353;
+    P<Zp<p>> a(pseudoRandomZp<p>(400, 7)), b(pseudoRandomZp<p>(150, 8));
+    auto [q, r] = Poly::DivRem<Zp<p>>::execute(a.get(), b.get());
+    EXPECT_EQ(q.degree(), 250u);
+    expectDivision<Zp<p>>(a, b, P<Zp<p>>(q), P<Zp<p>>(r));
+    EXPECT_TRUE(a / b == P<Zp<p>>(q));
+    EXPECT_TRUE(a % b == P<Zp<p>>(r));
+
+    Polynomial<Zp<p>> series = Poly::InverseSeries<Zp<p>>::execute(b.get(), 100);
+    Polynomial<Zp<p>> one = Poly::truncated(Poly::Mul<Zp<p>>::execute(b.get(), series).coefficients, 100);
+    EXPECT_TRUE(P<Zp<p>>(one) == P<Zp<p>>::identity());
+
+    // Редукция по фиксированному модулю: ряд дорастает при первом длинном делимом
+    Poly::Reducer<Zp<p>> mod_b(b.get());
+    EXPECT_TRUE(P<Zp<p>>(mod_b.rem(a.get())) == P<Zp<p>>(r));
+    P<Zp<p>> c(pseudoRandomZp<p>(1000, 9));
+    auto [qc, rc] = mod_b.divRem(c.get());
+    expectDivision<Zp<p>>(c, b, P<Zp<p>>(qc), P<Zp<p>>(rc));
+    EXPECT_TRUE(P<Zp<p>>(mod_b.rem(b.get())) == P<Zp<p>>::zero());
+}
+
+TEST(PolynomNewtonDiv2, Rational) {
+    std::vector<Q> ca, cb;
+    for (int i = 0; i < 160; ++i) ca.push_back(makeQ((i * 31) % 17 - 8, i % 3 + 1));
+    // Разреженный делитель: иначе коэффициенты обратного ряда над Q растут слишком быстро для теста
+    for (int i = 0; i < 70; ++i) cb.push_back(i % 23 == 0 ? makeQ(i % 2 ? -1 : 1) : Q::zero());
+    cb.back() = makeQ(3, 2);
+    P<Q> a(ca), b(cb);
+    P<Q> q = a / b, r = a % b;
+    EXPECT_EQ(q.degree(), 90u);
+    expectDivision<Q>(a, b, q, r);
+    EXPECT_THROW(Poly::InverseSeries<Q>::execute(Polynomial<Q>({Q::zero(), Q::identity()}), 4), UniversalStringException);
+}
+
+// НОД: half-GCD над Zp и Евклид над Q, проверяем делимость и соотношение Безу
+TEST(PolynomGcd1, HalfGcdZp) {
+    constexpr size_t p = 998244353;
+    std::vector<Zp<p>> cg = pseudoRandomZp<p>(61, 10);
+    cg.back() = Zp<p>::identity();
+    P<Zp<p>> g(cg), u(pseudoRandomZp<p>(170, 11)), v(pseudoRandomZp<p>(130, 12));
+    P<Zp<p>> a = g * u, b = g * v;
+
+    auto [d, s, t] = P<Zp<p>>::extendedGcd(a, b);
+    EXPECT_TRUE(d == g);
+    EXPECT_TRUE(s * a + t * b == d);
+    EXPECT_TRUE(P<Zp<p>>::gcd(b, a) == g);
+    Zp<p> one = Zp<p>::identity();
+    EXPECT_TRUE(P<Zp<p>>::gcd(a, a) == a * (one / a[a.degree()]));
+
+    // Взаимно простые: НОД 1
+    EXPECT_TRUE(P<Zp<p>>::gcd(u, P<Zp<p>>({one, one}) * u + P<Zp<p>>::identity()) ==
+                P<Zp<p>>::identity());
+}
+
+TEST(PolynomGcd2, Rational) {
+    // (x - 1)(x + 2) и (x - 1)(2x - 3)
+    P<Q> a({makeQ(-2), makeQ(1), makeQ(1)}), b({makeQ(3), makeQ(-5), makeQ(2)});
+    auto [d, s, t] = P<Q>::extendedGcd(a, b);
+    EXPECT_TRUE(d == P<Q>({makeQ(-1), makeQ(1)}));
+    EXPECT_TRUE(s * a + t * b == d);
+    EXPECT_TRUE(P<Q>::gcd(a, P<Q>::zero()) == a);
+    EXPECT_TRUE(P<Q>::gcd(P<Q>::zero(), b) == b * makeQ(1, 2));
+    EXPECT_THROW(P<Q>::gcd(P<Q>::zero(), P<Q>::zero()), UniversalStringException);
+}
+
+// Модулярный НОД над Q: общий множитель с дробями и большими коэффициентами
+TEST(PolynomGcd3, Modular) {
+    std::vector<Q> common_coeffs, left_coeffs, right_coeffs;
+    for (int i = 0; i < 25; ++i) common_coeffs.push_back(makeQ((i * 7919) % 1013 - 500, (i % 5) + 1));
+    common_coeffs.push_back(makeQ(3, 7));
+    for (int i = 0; i < 16; ++i) {
+        left_coeffs.push_back(makeQ((i * 104729) % 997 - 400, 1));
+        right_coeffs.push_back(makeQ((i * 1299709) % 991 - 300, (i % 3) + 2));
+    }
+    left_coeffs.push_back(makeQ(1));
+    right_coeffs.push_back(makeQ(5, 3));
+    P<Q> common(common_coeffs), left(left_coeffs), right(right_coeffs);
+    P<Q> a = common * left, b = common * right;
+
+    P<Q> g = P<Q>::gcd(a, b);
+    EXPECT_TRUE(g == common * makeQ(7, 3));
+    EXPECT_TRUE(a % g == P<Q>::zero());
+    EXPECT_TRUE(b % g == P<Q>::zero());
+
+    // Взаимно простые полиномы: НОД равен 1
+    P<Q> x2p1({makeQ(1), makeQ(0), makeQ(1)}), x2p2({makeQ(2), makeQ(0), makeQ(1)});
+    EXPECT_TRUE(P<Q>::gcd(x2p1, x2p2) == P<Q>::identity());
+    EXPECT_TRUE(P<Q>::gcd(a, a) == a * (Q::identity() / a[a.degree()]));
+    // НОД равен меньшему полиному: степень образа совпадает с границей min(deg a, deg b)
+    EXPECT_TRUE(P<Q>::gcd(a, common) == common * makeQ(7, 3));
+    EXPECT_TRUE(P<Q>::gcd(right, b) == right * makeQ(3, 5));
+}
+
+// Разреженные полиномы: память и время по числу членов, а не по степени
+TEST(PolynomSparse1, HugeDegree) {
+    SP<Q> one = SP<Q>::identity();
+    SP<Q> f = SP<Q>::monomial(makeQ(1), 1000000) + one;   // x^1000000 + 1
+    EXPECT_EQ(f.size(), 2u);
+    EXPECT_EQ(f.degree(), 1000000u);
+    EXPECT_FALSE(f.isDense());
+    EXPECT_EQ(f.toString(), "x^1000000 + 1/1");
+
+    SP<Q> square = f * f;
+    EXPECT_EQ(square.toString(), "x^2000000 + 2/1*x^1000000 + 1/1");
+    SP<Q> g = SP<Q>::monomial(makeQ(1), 1000000) - one;
+    EXPECT_TRUE(f * g == SP<Q>::monomial(makeQ(1), 2000000) - one);
+    EXPECT_TRUE((f * g) / g == f);
+    EXPECT_TRUE((f * g) % g == SP<Q>::zero());
+    EXPECT_TRUE(square % g == SP<Q>::monomial(makeQ(4), 0));
+
+    EXPECT_TRUE(f.evaluate(makeQ(1)) == makeQ(2));
+    EXPECT_TRUE(f.evaluate(makeQ(-1)) == makeQ(2));
+    EXPECT_TRUE((SP<Q>::monomial(makeQ(3), 10) + SP<Q>::monomial(makeQ(-1), 3)).evaluate(makeQ(1, 2)) == makeQ(-125, 1024));
+    EXPECT_TRUE(f.derivative() == SP<Q>::monomial(makeQ(1000000), 999999));
+    EXPECT_THROW(f / SP<Q>::zero(), UniversalStringException);
+}
+
+// Сверка с плотными полиномами: разреженный путь кучей и плотный путь через P<T>
+TEST(PolynomSparse2, MatchesDense) {
+    constexpr size_t p = 1000003;
+    std::vector<Zp<p>> ca = pseudoRandomZp<p>(40, 13), cb = pseudoRandomZp<p>(25, 14);
+    std::vector<SparseTerm<Zp<p>>> ta, tb;
+    for (size_t i = 0; i < ca.size(); ++i) ta.push_back({i * i, ca[i]});        // степени 0, 1, 4, 9, ...
+    for (size_t i = 0; i < cb.size(); ++i) tb.push_back({3 * i + (i % 2), cb[i]});
+    SP<Zp<p>> a(ta), b(tb);
+    P<Zp<p>> da = a.toDense(), db = b.toDense();
+    EXPECT_FALSE(a.isDense());
+    EXPECT_TRUE(b.isDense());
+
+    EXPECT_TRUE((a * b).toDense() == da * db);
+    EXPECT_TRUE((a + b).toDense() == da + db);
+    EXPECT_TRUE((a - a) == SP<Zp<p>>::zero());
+    EXPECT_TRUE((a / b).toDense() == da / db);
+    EXPECT_TRUE((a % b).toDense() == da % db);
+    EXPECT_TRUE(SP<Zp<p>>::fromDense(db) == b);
+    EXPECT_TRUE((b * b).toDense() == db * db);
+    EXPECT_TRUE(a.derivative().toDense() == da.derivative());
+
+    Zp<p> x(Z(std::int64_t{123457}));
+    EXPECT_TRUE(a.evaluate(x) == da.evaluate(x));
+    EXPECT_EQ(a.toString(), da.toString());
+}
+
+TEST(PolynomSparse3, IsRing) {
+    // Разреженный полином над полем является кольцом, как и плотный
+    static_assert(Ring<SP<Q>::SetType, SP<Q>::AdditionOp, SP<Q>::MultiplicationOp>,
+                  "SP<Q> must be a ring!");
+    EXPECT_TRUE(true);
+}
+
 // P6 - Деление
 TEST(PolynomDiv1, Basic) {
     // (x^2 + 3x + 2) / (x + 1) = x + 2
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <numeric>
+#include "core/realization/Natural/N.h"
+
+
+// S1 - Решето
+TEST(Sieve1, SmallRange) {
+    std::vector<std::uint64_t> expected = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47,
+                                           53, 59, 61, 67, 71, 73, 79, 83, 89, 97};
+    EXPECT_EQ(Primes::primesInRange(0, 100), expected);
+    EXPECT_EQ(Primes::primesUpTo(100), expected);
+    EXPECT_EQ(Primes::primesInRange(13, 14), (std::vector<std::uint64_t>{13}));
+    EXPECT_TRUE(Primes::primesInRange(24, 29).empty());
+}
+
+TEST(Sieve2, Segments) {
+    // Несколько сегментов подряд и границы, не попадающие на начало сегмента
+    std::vector<std::uint64_t> sieved = Primes::primesInRange(0, 1000000);
+    EXPECT_EQ(sieved.size(), 78498u);
+    EXPECT_EQ(sieved, Primes::primesUpTo(999999));
+
+    std::vector<std::uint64_t> far = Primes::primesInRange(1000000000000, 1000000000000 + 1000);
+    EXPECT_EQ(far.size(), 37u);
+    EXPECT_EQ(std::accumulate(far.begin(), far.end(), std::uint64_t{0}), 37000000018433u);
+    for (std::uint64_t p : far) EXPECT_TRUE(NatOper::isPrimeWord(p));
+}
+
+TEST(Sieve3, Parallel) {
+    std::uint64_t hi = std::uint64_t{1} << 25;
+    std::vector<std::uint64_t> single = Primes::primesInRange(0, hi, 1);
+    std::vector<std::uint64_t> parallel = Primes::primesInRange(0, hi, 4);
+    EXPECT_EQ(single.size(), 2063689u);
+    EXPECT_EQ(single, parallel);
+}
+
+// S2 - Таблица и перебор
+TEST(PrimeTable1, LazyGrowth) {
+    Primes::PrimeTable& table = Primes::PrimeTable::instance();
+    EXPECT_EQ(table.nth(0), 2u);
+    EXPECT_EQ(table.nth(999), 7919u);
+    EXPECT_EQ(table.upTo(100).size(), 25u);
+    EXPECT_GT(table.bound(), 7919u);
+}
+
+TEST(PrimeRange1, Iteration) {
+    std::vector<std::uint64_t> collected;
+    for (std::uint64_t p : Primes::PrimeRange(1000000, 1200000)) collected.push_back(p);
+    EXPECT_EQ(collected, Primes::primesInRange(1000000, 1200000));
+
+    std::size_t count = 0;
+    for (std::uint64_t p : Primes::PrimeRange(24, 29)) count += p;
+    EXPECT_EQ(count, 0u);
+}
+
+// S3 - Подбор модулей
+TEST(ModuliSelection1, NttPrimes) {
+    EXPECT_EQ(Primes::nttPrimes(23, 3, std::uint64_t{1} << 30),
+              (std::vector<std::uint64_t>{998244353, 897581057, 880803841}));
+    EXPECT_EQ(Primes::primitiveRoot(998244353), 3u);
+
+    std::uint64_t w = Primes::rootOfUnity(998244353, std::uint64_t{1} << 23);
+    EXPECT_EQ(NatOper::powModWord(w, std::uint64_t{1} << 23, 998244353), 1u);
+    EXPECT_NE(NatOper::powModWord(w, std::uint64_t{1} << 22, 998244353), 1u);
+    EXPECT_THROW(Primes::rootOfUnity(998244353, 3 * 5), UniversalStringException);
+}
+
+TEST(ModuliSelection2, CrtPrimes) {
+    EXPECT_EQ(Primes::crtPrimes(2), (std::vector<std::uint64_t>{4611686018427387847, 4611686018427387817}));
+}
+
+static_assert(Primes::primitiveRoot(7) == 3);
+static_assert(Primes::nttPrimes(20, 1, std::uint64_t{1} << 30).front() % (std::uint64_t{1} << 20) == 1);
+
+// F1 - Разложение на множители
+TEST(Factor1, Words) {
+    EXPECT_TRUE((1_N).factor().empty());
+    EXPECT_THROW((0_N).factor(), UniversalStringException);
+
+    auto small = (580609741824_N).factor();   // 2^10 * 3^4 * 7 * 1000003
+    ASSERT_EQ(small.size(), 4u);
+    EXPECT_EQ(small[0], std::make_pair(2_N, std::uint64_t{10}));
+    EXPECT_EQ(small[1], std::make_pair(3_N, std::uint64_t{4}));
+    EXPECT_EQ(small[2], std::make_pair(7_N, std::uint64_t{1}));
+    EXPECT_EQ(small[3], std::make_pair(1000003_N, std::uint64_t{1}));
+
+    auto semiprime = (18446743979220271189_N).factor();
+    ASSERT_EQ(semiprime.size(), 2u);
+    EXPECT_EQ(semiprime[0].first, 4294967279_N);
+    EXPECT_EQ(semiprime[1].first, 4294967291_N);
+}
+
+TEST(Factor2, BigNumbers) {
+    auto rho = (2305849926742721592081853_N).factor();   // 1000003 * (2^61 - 1)
+    ASSERT_EQ(rho.size(), 2u);
+    EXPECT_EQ(rho[0].first, 1000003_N);
+    EXPECT_EQ(rho[1].first, 2305843009213693951_N);
+
+    N mersenne = 618970019642690137449562111_N;   // 2^89 - 1
+    auto power = (mersenne.sqr() * 12_N).factor();
+    ASSERT_EQ(power.size(), 3u);
+    EXPECT_EQ(power[0], std::make_pair(2_N, std::uint64_t{2}));
+    EXPECT_EQ(power[1], std::make_pair(3_N, std::uint64_t{1}));
+    EXPECT_EQ(power[2], std::make_pair(mersenne, std::uint64_t{2}));
+}
+
+TEST(Factor3, EllipticCurves) {
+    Natural n = (999985999949_N).get();   // 999983 * 1000003
+    std::optional<Natural> divisor;
+    for (std::uint64_t sigma = 6; sigma < 40 && !divisor; ++sigma) {
+        divisor = NatOper::Ecm::execute(n, 500, sigma, NatOper::StopToken{});
+    }
+    ASSERT_TRUE(divisor.has_value());
+    EXPECT_TRUE(N(*divisor) == 999983_N || N(*divisor) == 1000003_N);
+}
+
+TEST(Factor4, Cancellation) {
+    std::atomic<bool> cancel{true};
+    NatOper::FactorOptions options;
+    options.cancel = &cancel;
+    EXPECT_THROW((2305849926742721592081853_N).factor(options), UniversalStringException);
+}
+
+TEST(Factor5, EulerPhi) {
+    EXPECT_EQ((1_N).eulerPhi(), 1_N);
+    EXPECT_EQ((97_N).eulerPhi(), 96_N);
+    EXPECT_EQ((580609741824_N).eulerPhi(), 165888331776_N);
+}
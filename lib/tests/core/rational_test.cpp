@@ -137,6 +137,181 @@ TEST(RationalEdge1, LargeNumbers) {
     EXPECT_EQ(big.toString(), "1/2");
 }
 
+// Операции с машинным словом
+TEST(RationalWordOps1, AddMulDiv) {
+    EXPECT_EQ(fromFrac("-3", "4").addUi(1).toString(), "1/4");
+    EXPECT_EQ(fromFrac("3", "4").mulUi(6).toString(), "9/2");
+    EXPECT_EQ(fromFrac("3", "4").mulUi(0).toString(), "0/1");
+    EXPECT_EQ(fromFrac("-6", "7").divUi(4).toString(), "-3/14");
+    EXPECT_THROW(fromFrac("1", "2").divUi(0), UniversalStringException);
+    EXPECT_EQ(Q(std::int64_t{-5}).toString(), "-5/1");
+}
+
+TEST(RationalWordOps2, Cmp) {
+    EXPECT_EQ(fromFrac("7", "2").cmpUi(3), 2);
+    EXPECT_EQ(fromFrac("6", "2").cmpUi(3), 0);
+    EXPECT_EQ(fromFrac("5", "2").cmpUi(3), 1);
+    EXPECT_EQ(fromFrac("-5", "2").cmpUi(0), 1);
+}
+
+// Литералы и вычисления на этапе компиляции
+static_assert(3_Q / 4_Q == Q(3_Z, 4_N));
+static_assert((6_Q / 8_Q).get().denominator == 4_N);
+static_assert((2_Q / 2_Q).isOne());
+
+TEST(RationalLiterals1, Basic) {
+    EXPECT_EQ((3_Q / 4_Q).toString(), "3/4");
+    EXPECT_EQ((-(3_Z) * 1_Z).toString(), "-3");
+    EXPECT_TRUE(Q::zero().isZero());
+    EXPECT_TRUE(Q::identity().isOne());
+    EXPECT_TRUE(fromFrac("4", "4").isOne());
+}
+
+// Точный корень
+TEST(RationalSqrt1, Exact) {
+    std::optional<Q> root = (Q(18_Z, 50_N)).sqrt();  // 9/25
+    ASSERT_TRUE(root.has_value());
+    EXPECT_EQ(*root, Q(3_Z, 5_N));
+    EXPECT_FALSE(Q(2_Z, 9_N).sqrt().has_value());
+    EXPECT_FALSE(Q(-1_Z, 4_N).sqrt().has_value());
+    EXPECT_TRUE((0_Q).isPerfectSquare());
+}
+
+// Ленивое сокращение
+TEST(RationalLazy1, HarmonicSum) {
+    Q sum(std::int64_t{0});
+    for (std::int64_t k = 1; k <= 30; ++k) {
+        sum = sum + Q(Z(std::int64_t{1}), N(static_cast<std::uint64_t>(k)));
+        EXPECT_LE(sum.get().denominator.get().nums.size(), 2 * Rat::lazy_reduce_digits);
+    }
+    EXPECT_EQ(sum.toString(), "9304682830147/2329089562800");
+    EXPECT_EQ(sum, fromFrac("9304682830147", "2329089562800"));
+}
+
+TEST(RationalLazy2, FlagAndNormalize) {
+    Q half = fromFrac("1", "2");
+    Q sum = half + half;
+    EXPECT_FALSE(sum.isReduced());
+    EXPECT_TRUE(sum.isOne());
+    EXPECT_EQ(sum.toString(), "1/1");
+    EXPECT_TRUE(Rat::isInt::execute(sum.get()));
+    sum.normalize();
+    EXPECT_TRUE(sum.isReduced());
+    EXPECT_EQ(sum.get().denominator, N(std::uint64_t{1}));
+    EXPECT_TRUE((sum - half - half).isZero());
+}
+
+TEST(RationalLazy3, HenriciOnThreshold) {
+    Q product(std::int64_t{1});
+    for (std::uint64_t k = 2; k < 60; ++k) {
+        product = product * Q(Z(N(k * k + 1)), N(k * k));
+    }
+    product.normalize();
+    EXPECT_EQ(product.toString(),
+              "482678697213389032672597983899526015937276382177783594983534468194209189157399853474221432000715680625/"
+              "267055773790465434192188882612002638544046859452548013198741495197267231169248235319876130963590217728");
+}
+
+TEST(RationalHenrici1, CrossCancel) {
+    Q quotient = fromFrac("4", "9") / fromFrac("-8", "3");
+    EXPECT_TRUE(quotient.isReduced());
+    EXPECT_EQ(quotient.get().denominator, N(std::uint64_t{6}));
+    EXPECT_EQ(quotient.toString(), "-1/6");
+    EXPECT_EQ(Rat::henriciMul(fromFrac("10", "21").get(), fromFrac("-7", "15").get()).denominator, N(std::uint64_t{9}));
+    EXPECT_EQ(Rat::henriciAdd(fromFrac("1", "6").get(), fromFrac("1", "3").get()).denominator, N(std::uint64_t{2}));
+    EXPECT_TRUE(Rat::henriciAdd(fromFrac("1", "6").get(), fromFrac("-1", "6").get()).denominator.isOne());
+}
+
+// Нулевая сумма: знаменатель 1, а не b*d/g
+TEST(RationalHenrici2, ZeroSum) {
+    Rational zero = Rat::henriciAdd(fromFrac("5", "12").get(), fromFrac("-5", "12").get());
+    EXPECT_TRUE(zero.numerator.isZero());
+    EXPECT_TRUE(zero.denominator.isOne());
+    EXPECT_TRUE(Rat::isInt::execute(zero));
+    EXPECT_EQ(Q(zero).toString(), "0/1");
+
+    Rational cancel = Rat::henriciAdd(fromFrac("7", "30").get(), fromFrac("-14", "60").get());
+    EXPECT_TRUE(cancel.denominator.isOne());
+    Q difference = fromFrac("11", "18") - fromFrac("22", "36");
+    EXPECT_TRUE(difference.isZero());
+    EXPECT_EQ(difference.toString(), "0/1");
+}
+
+// Поэтапное сравнение
+TEST(RationalCmpStaged1, SignsAndOrders) {
+    EXPECT_TRUE(fromFrac("-1", "1000000") < fromFrac("0", "1"));
+    EXPECT_TRUE(fromFrac("0", "7") == fromFrac("0", "3"));
+    EXPECT_TRUE(fromFrac("123456789012345678901234567890", "7") > fromFrac("1", "3"));
+    EXPECT_TRUE(fromFrac("-123456789012345678901234567890", "7") < fromFrac("-1", "3"));
+    EXPECT_TRUE(fromFrac("5", "11") < fromFrac("6", "11"));
+    EXPECT_TRUE(fromFrac("-5", "11") > fromFrac("-6", "11"));
+}
+
+TEST(RationalCmpStaged2, CloseValues) {
+    // 10^30/(10^30+1) и (10^30-1)/10^30 отличаются на 10^-60, приближения не хватает
+    Q x = fromFrac("1000000000000000000000000000000", "1000000000000000000000000000001");
+    Q y = fromFrac("999999999999999999999999999999", "1000000000000000000000000000000");
+    EXPECT_TRUE(x > y);
+    EXPECT_TRUE(y < x);
+    EXPECT_FALSE(x == y);
+    Q neg_x = Q(std::int64_t{0}) - x;
+    Q neg_y = Q(std::int64_t{0}) - y;
+    EXPECT_TRUE(neg_x < neg_y);
+    // Равные, но несокращенные дроби
+    EXPECT_TRUE(fromFrac("246913578024691357802469135780", "2000000000000000000000000000002") ==
+                fromFrac("123456789012345678901234567890", "1000000000000000000000000000001"));
+    // Разница заметна по старшим цифрам
+    EXPECT_TRUE(fromFrac("3141592653589793238462643383279", "1000000000000000000000000000000") >
+                fromFrac("314159265358979", "100000000000000"));
+}
+
+// Цепные дроби: отрицательное первое частное округляется вниз
+TEST(RationalContinuedFraction1, Expansion) {
+    auto asInts = [](const std::vector<Z>& quotients) {
+        std::vector<std::int64_t> out;
+        for (const Z& q : quotients) out.push_back(q.toInt64());
+        return out;
+    };
+    EXPECT_EQ(asInts(fromFrac("415", "93").continuedFraction()), (std::vector<std::int64_t>{4, 2, 6, 7}));
+    EXPECT_EQ(asInts(fromFrac("-415", "93").continuedFraction()), (std::vector<std::int64_t>{-5, 1, 1, 6, 7}));
+    EXPECT_EQ(asInts(fromFrac("-6", "3").continuedFraction()), (std::vector<std::int64_t>{-2}));
+    // Несокращенная дробь дает те же частные
+    EXPECT_EQ(asInts(fromFrac("830", "186").continuedFraction()), (std::vector<std::int64_t>{4, 2, 6, 7}));
+
+    // F(201)/F(200): сплошные единицы, длинные числа идут через шаги Лемера
+    Z f_prev(std::int64_t{0}), f(std::int64_t{1});
+    for (int i = 0; i < 200; ++i) {
+        Z next = f + f_prev;
+        f_prev = f;
+        f = next;
+    }
+    Q golden(f, Z::abs(f_prev));
+    std::vector<Z> ones = golden.continuedFraction();
+    ASSERT_EQ(ones.size(), 199u);
+    // последнее частное 2 вместо 1 + 1/1
+    for (std::size_t i = 0; i + 1 < ones.size(); ++i) EXPECT_TRUE(ones[i].isOne());
+    EXPECT_EQ(ones.back().toInt64(), 2);
+    EXPECT_TRUE(Q::fromContinuedFraction(ones) == golden);
+
+    Q big = fromFrac("-31415926535897932384626433832795028841971", "27182818284590452353602874713526624977572");
+    EXPECT_TRUE(Q::fromContinuedFraction(big.continuedFraction()) == big);
+}
+
+TEST(RationalContinuedFraction2, Convergents) {
+    Q pi = fromFrac("3141592653589793238462643383279", "1000000000000000000000000000000");
+    Rat::ConvergentStream stream = pi.convergents();
+    std::vector<std::string> first;
+    for (int i = 0; i < 5; ++i) first.push_back(Q(*stream.next()).toString());
+    EXPECT_EQ(first, (std::vector<std::string>{"3/1", "22/7", "333/106", "355/113", "103993/33102"}));
+
+    EXPECT_EQ(pi.bestApproximation(N(std::uint64_t{10})).toString(), "22/7");
+    EXPECT_EQ(pi.bestApproximation(N(std::uint64_t{100})).toString(), "311/99");
+    EXPECT_EQ(pi.bestApproximation(N(std::uint64_t{1000})).toString(), "355/113");
+    EXPECT_EQ(fromFrac("-7", "3").bestApproximation(N(std::uint64_t{1})).toString(), "-2/1");
+    EXPECT_EQ(fromFrac("5", "12").bestApproximation(N(std::uint64_t{100})).toString(), "5/12");
+    EXPECT_THROW(pi.bestApproximation(N(std::uint64_t{0})), UniversalStringException);
+}
+
 TEST(RingTestRational, bas5) {
 	bool res = UnitaryRing<Q::SetType, Q::AdditionOp, Q::MultiplicationOp>;
 
@@ -3,6 +3,8 @@
 
 #include "Exceptions/UniversalStringException.h"
 
+using namespace algstructures;
+
 
 // Z1 - abs
 TEST(IntegerAbs, Basic) {
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "algstructures/Natural.h"
 
+using namespace algstructures;
+
 
 // N1 — cmp
 TEST(NaturalCmp, Basic) {
@@ -3,6 +3,8 @@
 
 #include "Exceptions/UniversalStringException.h"
 
+using namespace algstructures;
+
 // Конструктор и геттеры
 TEST(PolynomBasic, Constructor) {
     // 2 + 3x + x^2
@@ -106,6 +108,23 @@ TEST(PolynomMultiply, Basic) {
     EXPECT_EQ(result.getCoefficients()[2].toString(), "1/1");
 }
 
+TEST(PolynomMultiply, Karatsuba) {
+    // (1 + 2x + ... + 120x^119)(1 - x) = 1 + x + ... + x^119 - 120x^120
+    std::vector<Rational> coeffs;
+    for (int i = 1; i <= 120; ++i) coeffs.push_back(Rational(std::to_string(i)));
+    Polynom p1(coeffs);
+    Polynom p2({Rational("1"), Rational("-1")});
+    Polynom result = p1 * p2;
+    EXPECT_EQ(result.getDegree(), 120);
+    for (size_t i = 0; i < 120; ++i) EXPECT_EQ(result.getCoefficients()[i].toString(), "1/1");
+    EXPECT_EQ(result.getCoefficients()[120].toString(), "-120/1");
+
+    // Квадрат: коэффициент при x^119 равен сумме k(121 - k)
+    Polynom square = p1 * p1;
+    EXPECT_EQ(square.getDegree(), 238);
+    EXPECT_EQ(square.getCoefficients()[119].toString(), "295240/1");
+}
+
 // P9 - деление
 TEST(PolynomDivide, Basic) {
     // (x^2 + 3x + 2) / (x + 1) = x + 2
@@ -163,4 +182,25 @@ TEST(PolynomMakeSquareFree, Basic) {
     Polynom p({Rational("1"), Rational("-2"), Rational("1")});
     Polynom result = p.makeSquareFree();
     EXPECT_EQ(result.getDegree(), 1);
+}
+
+TEST(PolynomGCD, Fractions) {
+    // (x - 1/2)(x + 3) и (x - 1/2)(2x - 5/3): НОД нормирован
+    Polynom p1({Rational("-3/2"), Rational("5/2"), Rational("1")});
+    Polynom p2({Rational("5/6"), Rational("-8/3"), Rational("2")});
+    Polynom result = Polynom::gcd(p1, p2);
+    EXPECT_EQ(result.getDegree(), 1);
+    EXPECT_EQ(result.getCoefficients()[0].toString(), "-1/2");
+    EXPECT_EQ(result.getCoefficients()[1].toString(), "1/1");
+}
+
+TEST(PolynomMakeSquareFree, Multiple) {
+    // (x - 1/2)^2 (x + 3)^3 -> (x - 1/2)(x + 3) с точностью до множителя
+    Polynom a({Rational("-1/2"), Rational("1")});
+    Polynom b({Rational("3"), Rational("1")});
+    Polynom p = a * a * b * b * b;
+    Polynom result = p.makeSquareFree();
+    EXPECT_EQ(result.getDegree(), 2);
+    EXPECT_EQ((result % a).getCoefficients()[0].getNumerator().getSign(), 0);
+    EXPECT_EQ((result % b).getCoefficients()[0].getNumerator().getSign(), 0);
 }
\ No newline at end of file
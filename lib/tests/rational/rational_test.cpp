@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "algstructures/Rational.h"
 
+using namespace algstructures;
+
 // --- 1. Конструкторы и строковое представление ---
 TEST(RationalTest, ConstructionAndToString) {
     // Обычная дробь
@@ -73,6 +75,31 @@ TEST(RationalTest, MultiplicationDivision) {
     EXPECT_EQ((Rational("5/8") * Rational("0")).toString(), "0/1");
 }
 
+// --- 4a. Арифметика Хенричи: результат сокращен без вызова reduce ---
+TEST(RationalTest, HenriciNoReduce) {
+    // 5/12 + 7/18: gcd(12, 18) = 6, (15 + 14)/36 = 29/36
+    EXPECT_EQ((Rational("5/12") + Rational("7/18")).toString(), "29/36");
+    // 1/6 + 1/3 = 1/2, сокращение на делитель общего НОД знаменателей
+    EXPECT_EQ((Rational("1/6") + Rational("1/3")).toString(), "1/2");
+    EXPECT_EQ((Rational("3/10") - Rational("3/10")).toString(), "0/1");
+    EXPECT_EQ((Rational("10/21") * Rational("-7/15")).toString(), "-2/9");
+    EXPECT_EQ((Rational("4/9") / Rational("-8/3")).toString(), "-1/6");
+}
+
+// --- 4b. Несократимые на входе операнды: конструкторы не сокращают, арифметика сокращает сама ---
+TEST(RationalTest, HenriciUnreducedOperands) {
+    Rational diff = Rational("6/4") - Rational("1/2");
+    EXPECT_EQ(diff.toString(), "1/1");
+    EXPECT_TRUE(diff.isInteger());
+    EXPECT_EQ((Rational("2/4") * Rational("1")).toString(), "1/2");
+    EXPECT_EQ((Rational("2/4") + Rational("0")).toString(), "1/2");
+    EXPECT_EQ((Rational("0/4") + Rational("3/9")).toString(), "1/3");
+    EXPECT_EQ((Rational("4/6") / Rational("-10/15")).toString(), "-1/1");
+    EXPECT_EQ((Rational(Integer("9"), Natural("12")) * Rational("8/3")).toString(), "2/1");
+    // Сам объект не меняется
+    EXPECT_EQ(Rational("2/4").toString(), "2/4");
+}
+
 // --- 5. Проверка на целое и конвертация ---
 TEST(RationalTest, IntegerConversion) {
     // 10/2 — это целое (5)